@@ -0,0 +1,583 @@
+/*
+ * Micro-benchmarks for wsh's data structures and parser.
+ *
+ * Every benchmark runs over a size sweep and reports the mean cost of a
+ * single operation together with the allocations and bytes it requested.
+ * Allocations are counted by the shim in src/alloc_stats.c, which this
+ * binary is linked against (see `make bench`).
+ *
+ * Usage: bench_micro [-m max_n] [filter]
+ *   -m max_n  largest size in the sweeps (default 100000; the alias
+ *            map is quadratic to build, so 1000000 takes many minutes)
+ *   filter    only run benchmarks whose name contains this string
+ */
+#include "../include/wsh.h"
+#include "../include/dynamic_array.h"
+#include "../include/hash_map.h"
+#include "../include/utils.h"
+#include "../include/strbuf.h"
+#include "../include/alloc_stats.h"
+#include "../include/tokenizer.h"
+#include "../include/expand.h"
+#include "../include/job_queue.h"
+#include "../include/event_loop.h"
+#include "../include/capture.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+extern HashMap *alias_hm;
+extern DynamicArray *history_da;
+
+static size_t max_n = 100000;
+static const char *filter = NULL;
+
+typedef struct {
+  struct timespec start;
+  AllocStats allocs;
+} BenchMark;
+
+static void bench_begin(BenchMark *m)
+{
+  alloc_stats_reset();
+  clock_gettime(CLOCK_MONOTONIC, &m->start);
+}
+
+/* Stop the clock and print one result row covering `ops` operations */
+static void bench_end(BenchMark *m, const char *name, size_t n, size_t ops)
+{
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  m->allocs = alloc_stats_get();
+
+  double ns = (end.tv_sec - m->start.tv_sec) * 1e9 + (end.tv_nsec - m->start.tv_nsec);
+  printf("%-28s %10zu %14.1f %12.2f %12.1f\n", name, n, ns / ops,
+         (double)m->allocs.allocs / ops, (double)m->allocs.bytes / ops);
+  fflush(stdout);
+}
+
+static int selected(const char *name)
+{
+  return filter == NULL || strstr(name, filter) != NULL;
+}
+
+/* Number of repetitions so that a sample of cheap operations takes long
+   enough to time reliably */
+static size_t reps_for(size_t n)
+{
+  size_t reps = 1000000 / (n ? n : 1);
+  return reps ? reps : 1;
+}
+
+/***************************************************
+ * HashMap (alias store)
+ ***************************************************/
+static void bench_hm(size_t n)
+{
+  char key[32];
+  BenchMark m;
+  HashMap *hm = hm_create();
+
+  bench_begin(&m);
+  for (size_t i = 0; i < n; i++)
+  {
+    snprintf(key, sizeof(key), "alias%zu", i);
+    hm_put(hm, key, "ls -alF");
+  }
+  if (selected("hm_put"))
+    bench_end(&m, "hm_put", n, n);
+
+  /* Lookups and deletions are sampled so the largest maps stay affordable */
+  size_t ops = 100000;
+  if (selected("hm_get"))
+  {
+    bench_begin(&m);
+    for (size_t i = 0; i < ops; i++)
+    {
+      snprintf(key, sizeof(key), "alias%zu", i % n);
+      if (!hm_get(hm, key))
+        abort();
+    }
+    bench_end(&m, "hm_get (hit)", n, ops);
+
+    bench_begin(&m);
+    for (size_t i = 0; i < ops; i++)
+    {
+      snprintf(key, sizeof(key), "missing%zu", i % n);
+      if (hm_get(hm, key))
+        abort();
+    }
+    bench_end(&m, "hm_get (miss)", n, ops);
+  }
+
+  /* Prefix queries seek the sorted index: alias -p prefix */
+  if (selected("hm_lower_bound"))
+  {
+    bench_begin(&m);
+    for (size_t i = 0; i < ops; i++)
+    {
+      snprintf(key, sizeof(key), "alias%zu", i % n);
+      if (!hm_lower_bound(hm, key))
+        abort();
+    }
+    bench_end(&m, "hm_lower_bound", n, ops);
+  }
+
+  if (selected("hm_delete"))
+  {
+    size_t dels = n < ops ? n : ops;
+    bench_begin(&m);
+    for (size_t i = 0; i < dels; i++)
+    {
+      snprintf(key, sizeof(key), "alias%zu", i);
+      hm_delete(hm, key);
+    }
+    bench_end(&m, "hm_delete", n, dels);
+  }
+  hm_free(hm);
+}
+
+/***************************************************
+ * DynamicArray (history)
+ ***************************************************/
+static void bench_da(size_t n)
+{
+  const char *line = "ls -l | grep .c | wc -l\n";
+  BenchMark m;
+  DynamicArray *da = da_create(0);
+
+  bench_begin(&m);
+  for (size_t i = 0; i < n; i++)
+    da_put(da, line);
+  if (selected("da_put"))
+    bench_end(&m, "da_put", n, n);
+
+  if (selected("da_delete"))
+  {
+    /* Deleting near the front shifts the whole tail, so only a bounded
+       number of deletions is timed per size */
+    size_t ops = n < 1000 ? n : 1000;
+    bench_begin(&m);
+    for (size_t i = 0; i < ops; i++)
+      da_delete(da, 0);
+    bench_end(&m, "da_delete (front)", n, ops);
+
+    bench_begin(&m);
+    for (size_t i = 0; i < ops && da->size > 0; i++)
+      da_delete(da, da->size - 1);
+    bench_end(&m, "da_delete (back)", n, ops);
+  }
+  da_free(da);
+}
+
+/***************************************************
+ * Parser
+ ***************************************************/
+
+/* Build a command line of `nargs` words, each `wordlen` bytes long, with
+   every fourth word single-quoted */
+static char *make_cmdline(size_t nargs, size_t wordlen)
+{
+  char *line = malloc(nargs * (wordlen + 3) + 2);
+  if (!line)
+    abort();
+  char *p = line;
+  for (size_t i = 0; i < nargs; i++)
+  {
+    int quoted = i % 4 == 3;
+    if (quoted)
+      *p++ = '\'';
+    for (size_t j = 0; j < wordlen; j++)
+      *p++ = quoted && j == wordlen / 2 ? ' ' : 'a' + (i + j) % 26;
+    if (quoted)
+      *p++ = '\'';
+    *p++ = ' ';
+  }
+  p[-1] = '\n';
+  *p = '\0';
+  return line;
+}
+
+static void bench_parse_line(const char *name, size_t n, const char *line)
+{
+  char *argv[MAX_ARGS + 1];
+  int argc;
+  size_t reps = reps_for(strlen(line));
+  BenchMark m;
+
+  bench_begin(&m);
+  for (size_t i = 0; i < reps; i++)
+  {
+    parseline_no_subst(line, argv, NULL, &argc);
+    free_argv(argv, argc);
+  }
+  bench_end(&m, name, n, reps);
+}
+
+static void bench_parser(void)
+{
+  if (!selected("parseline"))
+    return;
+
+  /* argv is a fixed MAX_ARGS array, so the argument count sweep stops there */
+  for (size_t nargs = 1; nargs <= MAX_ARGS; nargs *= 2)
+  {
+    size_t count = nargs < MAX_ARGS ? nargs : MAX_ARGS - 1;
+    char *line = make_cmdline(count, 8);
+    bench_parse_line("parseline_no_subst (argc)", count, line);
+    free(line);
+  }
+
+  /* Long lines: a fixed number of words, growing in length */
+  for (size_t len = 10; len <= max_n; len *= 10)
+  {
+    char *line = make_cmdline(8, len / 8 ? len / 8 : 1);
+    bench_parse_line("parseline_no_subst (bytes)", strlen(line), line);
+    free(line);
+  }
+}
+
+/* Byte classification alone, for each classifier the CPU supports */
+static void bench_classify(void)
+{
+  static const char *impls[] = {"scalar", "sse2", "avx2"};
+
+  if (!selected("tok_classify"))
+    return;
+
+  for (size_t len = 64; len <= max_n * 10; len *= 10)
+  {
+    char *line = make_cmdline(len / 10 ? len / 10 : 1, 8);
+    size_t n = strlen(line);
+    size_t nwords = TOK_MASK_WORDS(n);
+    uint64_t *masks = malloc(TOK_NMASKS * nwords * sizeof(uint64_t));
+    if (!masks)
+      abort();
+    ByteClasses bc = {0, 0, masks, masks + nwords, masks + 2 * nwords, masks + 3 * nwords};
+
+    for (size_t k = 0; k < sizeof(impls) / sizeof(impls[0]); k++)
+    {
+      char name[64];
+      if (tok_select(impls[k]) != 0)
+        continue;
+      snprintf(name, sizeof(name), "tok_classify (%s)", impls[k]);
+
+      size_t reps = reps_for(n) * 10;
+      BenchMark m;
+      bench_begin(&m);
+      for (size_t i = 0; i < reps; i++)
+        tok_classify(line, n, &bc);
+      bench_end(&m, name, n, reps);
+    }
+    free(masks);
+    free(line);
+  }
+  tok_select(NULL);
+}
+
+/***************************************************
+ * utils.c
+ ***************************************************/
+static void bench_replace_key(size_t n)
+{
+  if (!selected("replaceKey"))
+    return;
+
+  /* The key sits at the end so strstr scans the whole command */
+  char *command = malloc(n + 8);
+  if (!command)
+    abort();
+  memset(command, 'x', n);
+  strcpy(command + n, "$KEY");
+
+  size_t reps = reps_for(n);
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t i = 0; i < reps; i++)
+    free(replaceKey(command, "$KEY", "value"));
+  bench_end(&m, "replaceKey", n, reps);
+  free(command);
+}
+
+/***************************************************
+ * strbuf.c
+ ***************************************************/
+static void bench_strbuf(size_t n)
+{
+  if (!selected("sb_append"))
+    return;
+
+  /* One string built from n pieces: time per build grows linearly with n
+     and reallocations logarithmically, where append grew it per piece */
+  size_t reps = reps_for(n);
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t i = 0; i < reps; i++)
+  {
+    StrBuf sb = STRBUF_INIT;
+    for (size_t j = 0; j < n; j++)
+      sb_append(&sb, "piece ", 6);
+    sb_free(&sb);
+  }
+  bench_end(&m, "sb_append", n, reps);
+}
+
+/***************************************************
+ * expand.c
+ ***************************************************/
+static void bench_expand_word(size_t n)
+{
+  if (!selected("expand_word"))
+    return;
+
+  /* n parameters in one word: replaceKey would copy the word for each */
+  char *word = malloc(n * 4 + 1);
+  if (!word)
+    abort();
+  for (size_t i = 0; i < n; i++)
+    memcpy(word + i * 4, "$K/x", 4);
+  word[n * 4] = '\0';
+  setenv("K", "value", 1);
+
+  size_t reps = reps_for(n * 4);
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t i = 0; i < reps; i++)
+    free(expand_word(word));
+  bench_end(&m, "expand_word", n, reps);
+  unsetenv("K");
+  free(word);
+}
+
+/***************************************************
+ * job_queue.c
+ ***************************************************/
+static void *bench_jq_producer(void *arg)
+{
+  JobQueue *q = arg;
+  for (uintptr_t i = 1; i <= 200000; i++)
+  {
+    if (jq_push(q, (void *)i) != 0)
+      abort();
+  }
+  jq_close(q);
+  return NULL;
+}
+
+static void bench_job_queue(size_t n)
+{
+  BenchMark m;
+  JobQueue *q = jq_create(n);
+
+  /* n items in and out again from one thread: the uncontended cost */
+  if (selected("jq_push_pop"))
+  {
+    size_t reps = reps_for(n);
+    bench_begin(&m);
+    for (size_t r = 0; r < reps; r++)
+    {
+      for (uintptr_t i = 1; i <= n; i++)
+        jq_try_push(q, (void *)i);
+      for (size_t i = 0; i < n; i++)
+        if (!jq_try_pop(q))
+          abort();
+    }
+    bench_end(&m, "jq_push_pop", n, reps * n);
+  }
+
+  /* Handoff to another thread through a queue of capacity n */
+  if (selected("jq_handoff"))
+  {
+    pthread_t producer;
+    size_t items = 0;
+    bench_begin(&m);
+    if (pthread_create(&producer, NULL, bench_jq_producer, q) != 0)
+      abort();
+    while (jq_pop(q))
+      items++;
+    pthread_join(producer, NULL);
+    bench_end(&m, "jq_handoff", n, items);
+  }
+  jq_free(q);
+}
+
+/***************************************************
+ * event_loop.c
+ ***************************************************/
+static void bench_ev_drain(int fd, unsigned events, void *data)
+{
+  (void)events;
+  char byte;
+  if (read(fd, &byte, 1) == 1)
+    (*(size_t *)data)++;
+}
+
+/* One pipe made readable and its callback run, with n pipes watched */
+static void bench_ev_wakeup(const char *backend, const char *label, size_t n)
+{
+  if (!selected(label) || n > 1000)
+    return;
+  ev_free();
+  setenv("WSH_EVENT_LOOP", backend, 1);
+
+  int (*fds)[2] = malloc(n * sizeof(*fds));
+  if (!fds)
+    abort();
+  size_t woken = 0;
+  for (size_t i = 0; i < n; i++)
+  {
+    if (pipe(fds[i]) == -1 || ev_watch_fd(fds[i][0], EV_READ, bench_ev_drain, &woken) == -1)
+      abort();
+  }
+
+  size_t reps = 100000;
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t r = 0; r < reps; r++)
+  {
+    if (write(fds[r % n][1], "x", 1) != 1 || ev_run_once(-1) != 1)
+      abort();
+  }
+  bench_end(&m, label, n, woken);
+
+  ev_free();
+  for (size_t i = 0; i < n; i++)
+  {
+    close(fds[i][0]);
+    close(fds[i][1]);
+  }
+  free(fds);
+  unsetenv("WSH_EVENT_LOOP");
+}
+
+/***************************************************
+ * capture.c
+ ***************************************************/
+static void bench_capture(size_t n)
+{
+  if (!selected("capture_write"))
+    return;
+
+  /* The output of n finished jobs, one line each, written to /dev/null
+     with batched writev calls or with one call per job */
+  Capture *caps = malloc(n * sizeof(Capture));
+  Capture **order = malloc(n * sizeof(Capture *));
+  int fd = open("/dev/null", O_WRONLY);
+  if (!caps || !order || fd == -1)
+    abort();
+  for (size_t i = 0; i < n; i++)
+  {
+    caps[i] = (Capture){.fd = -1, .watch = -1, .mem = STRBUF_INIT, .spill_fd = -1};
+    sb_printf(&caps[i].mem, "output of job %zu\n", i);
+    order[i] = &caps[i];
+  }
+
+  size_t reps = reps_for(n);
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t r = 0; r < reps; r++)
+  {
+    if (capture_write(fd, order, n) == -1)
+      abort();
+  }
+  bench_end(&m, "capture_write", n, reps * n);
+
+  bench_begin(&m);
+  for (size_t r = 0; r < reps; r++)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      if (capture_write(fd, &order[i], 1) == -1)
+        abort();
+    }
+  }
+  bench_end(&m, "capture_write (per job)", n, reps * n);
+
+  for (size_t i = 0; i < n; i++)
+    capture_free(&caps[i]);
+  close(fd);
+  free(order);
+  free(caps);
+}
+
+/***************************************************
+ * PATH search
+ ***************************************************/
+static void bench_find_executable(const char *name, const char *label, size_t ndirs)
+{
+  /* Prepend ndirs - 2 nonexistent directories to the default PATH */
+  size_t len = 32 + ndirs * 24;
+  char *path = malloc(len);
+  if (!path)
+    abort();
+  path[0] = '\0';
+  size_t off = 0;
+  for (size_t i = 2; i < ndirs; i++)
+    off += snprintf(path + off, len - off, "/nonexistent/dir%zu:", i);
+  snprintf(path + off, len - off, "/bin:/usr/bin");
+  setenv("PATH", path, 1);
+  free(path);
+
+  /* The first lookup builds the PATH index (the missing directories are
+     watched through /); time the lookups it then serves */
+  free(find_executable_path(name));
+  size_t reps = 200000 / ndirs;
+  BenchMark m;
+  bench_begin(&m);
+  for (size_t i = 0; i < reps; i++)
+    free(find_executable_path(name));
+  bench_end(&m, label, ndirs, reps);
+}
+
+static void bench_path(void)
+{
+  if (!selected("find_executable_path"))
+    return;
+
+  for (size_t ndirs = 2; ndirs <= 128; ndirs *= 4)
+  {
+    bench_find_executable("ls", "find_executable_path (hit)", ndirs);
+    bench_find_executable("no-such-command", "find_executable_path (miss)", ndirs);
+  }
+  setenv("PATH", "/bin:/usr/bin", 1);
+}
+
+int main(int argc, char **argv)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+      max_n = strtoull(argv[++i], NULL, 10);
+    else
+      filter = argv[i];
+  }
+
+  alias_hm = hm_create();
+  history_da = da_create(0);
+
+  printf("%-28s %10s %14s %12s %12s\n", "benchmark", "n", "ns/op", "allocs/op", "bytes/op");
+  for (size_t n = 10; n <= max_n; n *= 10)
+  {
+    bench_hm(n);
+    bench_da(n);
+    bench_replace_key(n);
+    bench_strbuf(n);
+    bench_expand_word(n);
+    bench_job_queue(n);
+    bench_ev_wakeup("io_uring", "ev_wakeup (io_uring)", n);
+    bench_ev_wakeup("epoll", "ev_wakeup (epoll)", n);
+    bench_capture(n);
+  }
+  bench_parser();
+  bench_classify();
+  bench_path();
+
+  wsh_free();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+#
+# Compare wsh build variants (e.g. wsh, wsh-lto, wsh-pgo, wsh-static).
+#
+# For each binary prints its size, the wall-clock cost of starting it on an
+# empty script (exec, dynamic loading and shell init) and the in-process
+# startup time reported by --startup-profile, then runs the end-to-end
+# spawn-throughput benchmark (bench/e2e.sh) on all of them.
+#
+# Usage: bench/compare_builds.sh [-s starts] [-n commands] [-r runs] [-w workload,...] wsh...
+#   -s starts     startups timed per binary (default 500)
+#   -n, -r, -w    passed on to bench/e2e.sh
+
+set -euo pipefail
+
+starts=500
+e2e_args=(-B)
+
+while getopts "s:n:r:w:" opt; do
+  case $opt in
+    s) starts=$OPTARG ;;
+    n | r | w) e2e_args+=("-$opt" "$OPTARG") ;;
+    *) sed -n '2,13p' "$0" >&2; exit 2 ;;
+  esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -eq 0 ]]; then
+  sed -n '2,13p' "$0" >&2
+  exit 2
+fi
+
+tmpdir=$(mktemp -d)
+trap 'rm -rf "$tmpdir"' EXIT
+: >"$tmpdir/empty.wsh"
+
+# Startups use no rc file and no script cache so every binary does the same work
+export WSH_RC=/dev/null WSH_NO_CACHE=1
+
+# Print the median of the numbers on stdin
+median() {
+  sort -n | awk '{ v[NR] = $1 } END { print (NR ? v[int((NR + 1) / 2)] : 0) }'
+}
+
+printf "%-12s %10s %14s %14s\n" "binary" "bytes" "start us" "init us"
+for wsh in "$@"; do
+  if [[ ! -x $wsh ]]; then
+    echo "wsh binary not found: $wsh" >&2
+    exit 1
+  fi
+
+  t0=$(date +%s%N)
+  for ((i = 0; i < starts; i++)); do
+    "$wsh" "$tmpdir/empty.wsh"
+  done
+  t1=$(date +%s%N)
+
+  init=$(for ((i = 0; i < 50; i++)); do
+    "$wsh" --startup-profile "$tmpdir/empty.wsh" 2>&1 | awk '$1 == "total" { print $2 }'
+  done | median)
+
+  printf "%-12s %10d %14.1f %14.1f\n" "$(basename "$wsh")" "$(stat -c %s "$wsh")" \
+    "$(awk -v ns="$((t1 - t0))" -v n="$starts" 'BEGIN { print ns / n / 1000 }')" "$init"
+done
+
+echo
+unset WSH_NO_CACHE
+"$(dirname "$0")/e2e.sh" "${e2e_args[@]}" "$@"
@@ -0,0 +1,184 @@
+#!/usr/bin/env bash
+#
+# End-to-end spawn-throughput benchmark for wsh.
+#
+# Generates batch scripts for a few representative workloads, runs each one
+# several times under wsh (and under dash/bash when they are installed, as a
+# baseline) and reports commands per second plus per-run latency percentiles.
+#
+# Usage: bench/e2e.sh [-n commands] [-r runs] [-w workload,...] [-g dir] [-B] [-j jobs [-k]] [wsh...]
+#   -n commands   command lines per generated script (default 1000)
+#   -r runs       timed runs per script and shell (default 10)
+#   -w workloads  comma separated subset of: trivial,pipeline,alias,argv
+#   -g dir        only generate the scripts into dir and exit
+#   -B            skip the dash/bash baselines
+#   -j jobs       also run each script under wsh -j jobs
+#   -k            ...and under wsh -j jobs -k (output kept in order)
+#   wsh...        wsh binaries under test (default ./wsh)
+
+set -euo pipefail
+
+ncmds=1000
+runs=10
+workloads="trivial,pipeline,alias,argv"
+gen_only=""
+no_baselines=""
+jobs=""
+keep_order=""
+
+while getopts "n:r:w:g:Bj:k" opt; do
+  case $opt in
+    n) ncmds=$OPTARG ;;
+    r) runs=$OPTARG ;;
+    w) workloads=$OPTARG ;;
+    g) gen_only=$OPTARG ;;
+    B) no_baselines=1 ;;
+    j) jobs=$OPTARG ;;
+    k) keep_order=1 ;;
+    *) sed -n '2,19p' "$0" >&2; exit 2 ;;
+  esac
+done
+shift $((OPTIND - 1))
+wshs=("${@:-./wsh}")
+
+PIPE_STAGES=4 # stages per line in the pipeline workload
+NALIASES=50   # aliases defined by the alias workload
+NARGS=100     # arguments per line in the argv workload (below MAX_ARGS
+              # and MAX_LINE)
+
+# gen_<workload> <dialect> writes a script to stdout. The dialect is "wsh"
+# or "posix"; they differ in alias syntax, and the posix scripts name
+# commands by absolute path so that baseline shells fork and exec them
+# instead of running their `true`/`echo` builtins.
+bin_prefix() {
+  [[ $1 == posix ]] && echo "/bin/" || true
+}
+
+gen_trivial() {
+  local bin
+  bin=$(bin_prefix "$1")
+  for ((i = 0; i < ncmds; i++)); do
+    echo "${bin}true"
+  done
+}
+
+gen_pipeline() {
+  local bin
+  bin=$(bin_prefix "$1")
+  local line="${bin}echo pipeline"
+  for ((s = 1; s < PIPE_STAGES; s++)); do
+    line+=" | ${bin}cat"
+  done
+  for ((i = 0; i < ncmds; i++)); do
+    echo "$line"
+  done
+}
+
+gen_alias() {
+  local bin
+  bin=$(bin_prefix "$1")
+  [[ $1 == posix ]] && echo "shopt -s expand_aliases 2>/dev/null"
+  for ((a = 0; a < NALIASES; a++)); do
+    if [[ $1 == wsh ]]; then
+      echo "alias t$a = '${bin}true -a$a'"
+    else
+      echo "alias t$a='${bin}true -a$a'"
+    fi
+  done
+  for ((i = 0; i < ncmds; i++)); do
+    echo "t$((i % NALIASES)) arg$i"
+  done
+}
+
+gen_argv() {
+  local bin
+  bin=$(bin_prefix "$1")
+  local line="${bin}true"
+  for ((a = 0; a < NARGS; a++)); do
+    line+=" arg$a"
+  done
+  for ((i = 0; i < ncmds; i++)); do
+    echo "$line"
+  done
+}
+
+# Generate every selected workload into directory $1
+generate() {
+  mkdir -p "$1"
+  for w in ${workloads//,/ }; do
+    "gen_$w" wsh >"$1/$w.wsh"
+    "gen_$w" posix >"$1/$w.sh"
+  done
+}
+
+# Print "p50 p90 p99" of the numbers on stdin
+percentiles() {
+  sort -n | awk '{ v[NR] = $1 }
+    END {
+      split("50 90 99", ps, " ")
+      for (i = 1; i <= 3; i++) {
+        k = int((ps[i] / 100) * NR + 0.999999); if (k < 1) k = 1
+        printf "%s%.2f", (i > 1 ? " " : ""), v[k]
+      }
+      printf "\n"
+    }'
+}
+
+# bench_one <label> <shell> <script> [option...]: time `runs` executions of
+# shell option... script and print a row
+bench_one() {
+  local label=$1 shell=$2 script=$3 samples=()
+  local options=("${@:4}")
+  for ((r = 0; r < runs; r++)); do
+    local t0 t1
+    t0=$(date +%s%N)
+    "$shell" "${options[@]+"${options[@]}"}" "$script" >/dev/null 2>&1 || true
+    t1=$(date +%s%N)
+    samples+=($(((t1 - t0) / 1000)))
+  done
+
+  local p50 p90 p99
+  read -r p50 p90 p99 < <(printf '%s\n' "${samples[@]}" | awk '{ print $1 / 1000 }' | percentiles)
+  printf "%-10s %-10s %8d %12.0f %10.2f %10.2f %10.2f\n" "$label" "$(basename "$shell")${options[*]+ ${options[*]}}" \
+    "$ncmds" "$(awk -v n="$ncmds" -v ms="$p50" 'BEGIN { print (ms > 0 ? n * 1000 / ms : 0) }')" \
+    "$p50" "$p90" "$p99"
+}
+
+if [[ -n $gen_only ]]; then
+  generate "$gen_only"
+  exit 0
+fi
+
+for wsh in "${wshs[@]}"; do
+  if [[ ! -x $wsh ]]; then
+    echo "wsh binary not found: $wsh (run make first)" >&2
+    exit 1
+  fi
+done
+
+tmpdir=$(mktemp -d)
+trap 'rm -rf "$tmpdir"' EXIT
+generate "$tmpdir"
+
+baselines=()
+for sh in dash bash; do
+  if [[ -z $no_baselines ]] && command -v "$sh" >/dev/null 2>&1; then
+    baselines+=("$(command -v "$sh")")
+  fi
+done
+
+printf "%-10s %-10s %8s %12s %10s %10s %10s\n" "workload" "shell" "cmds" "cmds/sec" "p50 ms" "p90 ms" "p99 ms"
+for w in ${workloads//,/ }; do
+  for wsh in "${wshs[@]}"; do
+    bench_one "$w" "$wsh" "$tmpdir/$w.wsh"
+    if [[ -n $jobs ]]; then
+      bench_one "$w" "$wsh" "$tmpdir/$w.wsh" -j "$jobs"
+      if [[ -n $keep_order ]]; then
+        bench_one "$w" "$wsh" "$tmpdir/$w.wsh" -j "$jobs" -k
+      fi
+    fi
+  done
+  for sh in "${baselines[@]+"${baselines[@]}"}"; do
+    bench_one "$w" "$sh" "$tmpdir/$w.sh"
+  done
+done
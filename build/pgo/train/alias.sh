@@ -0,0 +1,2051 @@
+shopt -s expand_aliases 2>/dev/null
+alias t0='/bin/true -a0'
+alias t1='/bin/true -a1'
+alias t2='/bin/true -a2'
+alias t3='/bin/true -a3'
+alias t4='/bin/true -a4'
+alias t5='/bin/true -a5'
+alias t6='/bin/true -a6'
+alias t7='/bin/true -a7'
+alias t8='/bin/true -a8'
+alias t9='/bin/true -a9'
+alias t10='/bin/true -a10'
+alias t11='/bin/true -a11'
+alias t12='/bin/true -a12'
+alias t13='/bin/true -a13'
+alias t14='/bin/true -a14'
+alias t15='/bin/true -a15'
+alias t16='/bin/true -a16'
+alias t17='/bin/true -a17'
+alias t18='/bin/true -a18'
+alias t19='/bin/true -a19'
+alias t20='/bin/true -a20'
+alias t21='/bin/true -a21'
+alias t22='/bin/true -a22'
+alias t23='/bin/true -a23'
+alias t24='/bin/true -a24'
+alias t25='/bin/true -a25'
+alias t26='/bin/true -a26'
+alias t27='/bin/true -a27'
+alias t28='/bin/true -a28'
+alias t29='/bin/true -a29'
+alias t30='/bin/true -a30'
+alias t31='/bin/true -a31'
+alias t32='/bin/true -a32'
+alias t33='/bin/true -a33'
+alias t34='/bin/true -a34'
+alias t35='/bin/true -a35'
+alias t36='/bin/true -a36'
+alias t37='/bin/true -a37'
+alias t38='/bin/true -a38'
+alias t39='/bin/true -a39'
+alias t40='/bin/true -a40'
+alias t41='/bin/true -a41'
+alias t42='/bin/true -a42'
+alias t43='/bin/true -a43'
+alias t44='/bin/true -a44'
+alias t45='/bin/true -a45'
+alias t46='/bin/true -a46'
+alias t47='/bin/true -a47'
+alias t48='/bin/true -a48'
+alias t49='/bin/true -a49'
+t0 arg0
+t1 arg1
+t2 arg2
+t3 arg3
+t4 arg4
+t5 arg5
+t6 arg6
+t7 arg7
+t8 arg8
+t9 arg9
+t10 arg10
+t11 arg11
+t12 arg12
+t13 arg13
+t14 arg14
+t15 arg15
+t16 arg16
+t17 arg17
+t18 arg18
+t19 arg19
+t20 arg20
+t21 arg21
+t22 arg22
+t23 arg23
+t24 arg24
+t25 arg25
+t26 arg26
+t27 arg27
+t28 arg28
+t29 arg29
+t30 arg30
+t31 arg31
+t32 arg32
+t33 arg33
+t34 arg34
+t35 arg35
+t36 arg36
+t37 arg37
+t38 arg38
+t39 arg39
+t40 arg40
+t41 arg41
+t42 arg42
+t43 arg43
+t44 arg44
+t45 arg45
+t46 arg46
+t47 arg47
+t48 arg48
+t49 arg49
+t0 arg50
+t1 arg51
+t2 arg52
+t3 arg53
+t4 arg54
+t5 arg55
+t6 arg56
+t7 arg57
+t8 arg58
+t9 arg59
+t10 arg60
+t11 arg61
+t12 arg62
+t13 arg63
+t14 arg64
+t15 arg65
+t16 arg66
+t17 arg67
+t18 arg68
+t19 arg69
+t20 arg70
+t21 arg71
+t22 arg72
+t23 arg73
+t24 arg74
+t25 arg75
+t26 arg76
+t27 arg77
+t28 arg78
+t29 arg79
+t30 arg80
+t31 arg81
+t32 arg82
+t33 arg83
+t34 arg84
+t35 arg85
+t36 arg86
+t37 arg87
+t38 arg88
+t39 arg89
+t40 arg90
+t41 arg91
+t42 arg92
+t43 arg93
+t44 arg94
+t45 arg95
+t46 arg96
+t47 arg97
+t48 arg98
+t49 arg99
+t0 arg100
+t1 arg101
+t2 arg102
+t3 arg103
+t4 arg104
+t5 arg105
+t6 arg106
+t7 arg107
+t8 arg108
+t9 arg109
+t10 arg110
+t11 arg111
+t12 arg112
+t13 arg113
+t14 arg114
+t15 arg115
+t16 arg116
+t17 arg117
+t18 arg118
+t19 arg119
+t20 arg120
+t21 arg121
+t22 arg122
+t23 arg123
+t24 arg124
+t25 arg125
+t26 arg126
+t27 arg127
+t28 arg128
+t29 arg129
+t30 arg130
+t31 arg131
+t32 arg132
+t33 arg133
+t34 arg134
+t35 arg135
+t36 arg136
+t37 arg137
+t38 arg138
+t39 arg139
+t40 arg140
+t41 arg141
+t42 arg142
+t43 arg143
+t44 arg144
+t45 arg145
+t46 arg146
+t47 arg147
+t48 arg148
+t49 arg149
+t0 arg150
+t1 arg151
+t2 arg152
+t3 arg153
+t4 arg154
+t5 arg155
+t6 arg156
+t7 arg157
+t8 arg158
+t9 arg159
+t10 arg160
+t11 arg161
+t12 arg162
+t13 arg163
+t14 arg164
+t15 arg165
+t16 arg166
+t17 arg167
+t18 arg168
+t19 arg169
+t20 arg170
+t21 arg171
+t22 arg172
+t23 arg173
+t24 arg174
+t25 arg175
+t26 arg176
+t27 arg177
+t28 arg178
+t29 arg179
+t30 arg180
+t31 arg181
+t32 arg182
+t33 arg183
+t34 arg184
+t35 arg185
+t36 arg186
+t37 arg187
+t38 arg188
+t39 arg189
+t40 arg190
+t41 arg191
+t42 arg192
+t43 arg193
+t44 arg194
+t45 arg195
+t46 arg196
+t47 arg197
+t48 arg198
+t49 arg199
+t0 arg200
+t1 arg201
+t2 arg202
+t3 arg203
+t4 arg204
+t5 arg205
+t6 arg206
+t7 arg207
+t8 arg208
+t9 arg209
+t10 arg210
+t11 arg211
+t12 arg212
+t13 arg213
+t14 arg214
+t15 arg215
+t16 arg216
+t17 arg217
+t18 arg218
+t19 arg219
+t20 arg220
+t21 arg221
+t22 arg222
+t23 arg223
+t24 arg224
+t25 arg225
+t26 arg226
+t27 arg227
+t28 arg228
+t29 arg229
+t30 arg230
+t31 arg231
+t32 arg232
+t33 arg233
+t34 arg234
+t35 arg235
+t36 arg236
+t37 arg237
+t38 arg238
+t39 arg239
+t40 arg240
+t41 arg241
+t42 arg242
+t43 arg243
+t44 arg244
+t45 arg245
+t46 arg246
+t47 arg247
+t48 arg248
+t49 arg249
+t0 arg250
+t1 arg251
+t2 arg252
+t3 arg253
+t4 arg254
+t5 arg255
+t6 arg256
+t7 arg257
+t8 arg258
+t9 arg259
+t10 arg260
+t11 arg261
+t12 arg262
+t13 arg263
+t14 arg264
+t15 arg265
+t16 arg266
+t17 arg267
+t18 arg268
+t19 arg269
+t20 arg270
+t21 arg271
+t22 arg272
+t23 arg273
+t24 arg274
+t25 arg275
+t26 arg276
+t27 arg277
+t28 arg278
+t29 arg279
+t30 arg280
+t31 arg281
+t32 arg282
+t33 arg283
+t34 arg284
+t35 arg285
+t36 arg286
+t37 arg287
+t38 arg288
+t39 arg289
+t40 arg290
+t41 arg291
+t42 arg292
+t43 arg293
+t44 arg294
+t45 arg295
+t46 arg296
+t47 arg297
+t48 arg298
+t49 arg299
+t0 arg300
+t1 arg301
+t2 arg302
+t3 arg303
+t4 arg304
+t5 arg305
+t6 arg306
+t7 arg307
+t8 arg308
+t9 arg309
+t10 arg310
+t11 arg311
+t12 arg312
+t13 arg313
+t14 arg314
+t15 arg315
+t16 arg316
+t17 arg317
+t18 arg318
+t19 arg319
+t20 arg320
+t21 arg321
+t22 arg322
+t23 arg323
+t24 arg324
+t25 arg325
+t26 arg326
+t27 arg327
+t28 arg328
+t29 arg329
+t30 arg330
+t31 arg331
+t32 arg332
+t33 arg333
+t34 arg334
+t35 arg335
+t36 arg336
+t37 arg337
+t38 arg338
+t39 arg339
+t40 arg340
+t41 arg341
+t42 arg342
+t43 arg343
+t44 arg344
+t45 arg345
+t46 arg346
+t47 arg347
+t48 arg348
+t49 arg349
+t0 arg350
+t1 arg351
+t2 arg352
+t3 arg353
+t4 arg354
+t5 arg355
+t6 arg356
+t7 arg357
+t8 arg358
+t9 arg359
+t10 arg360
+t11 arg361
+t12 arg362
+t13 arg363
+t14 arg364
+t15 arg365
+t16 arg366
+t17 arg367
+t18 arg368
+t19 arg369
+t20 arg370
+t21 arg371
+t22 arg372
+t23 arg373
+t24 arg374
+t25 arg375
+t26 arg376
+t27 arg377
+t28 arg378
+t29 arg379
+t30 arg380
+t31 arg381
+t32 arg382
+t33 arg383
+t34 arg384
+t35 arg385
+t36 arg386
+t37 arg387
+t38 arg388
+t39 arg389
+t40 arg390
+t41 arg391
+t42 arg392
+t43 arg393
+t44 arg394
+t45 arg395
+t46 arg396
+t47 arg397
+t48 arg398
+t49 arg399
+t0 arg400
+t1 arg401
+t2 arg402
+t3 arg403
+t4 arg404
+t5 arg405
+t6 arg406
+t7 arg407
+t8 arg408
+t9 arg409
+t10 arg410
+t11 arg411
+t12 arg412
+t13 arg413
+t14 arg414
+t15 arg415
+t16 arg416
+t17 arg417
+t18 arg418
+t19 arg419
+t20 arg420
+t21 arg421
+t22 arg422
+t23 arg423
+t24 arg424
+t25 arg425
+t26 arg426
+t27 arg427
+t28 arg428
+t29 arg429
+t30 arg430
+t31 arg431
+t32 arg432
+t33 arg433
+t34 arg434
+t35 arg435
+t36 arg436
+t37 arg437
+t38 arg438
+t39 arg439
+t40 arg440
+t41 arg441
+t42 arg442
+t43 arg443
+t44 arg444
+t45 arg445
+t46 arg446
+t47 arg447
+t48 arg448
+t49 arg449
+t0 arg450
+t1 arg451
+t2 arg452
+t3 arg453
+t4 arg454
+t5 arg455
+t6 arg456
+t7 arg457
+t8 arg458
+t9 arg459
+t10 arg460
+t11 arg461
+t12 arg462
+t13 arg463
+t14 arg464
+t15 arg465
+t16 arg466
+t17 arg467
+t18 arg468
+t19 arg469
+t20 arg470
+t21 arg471
+t22 arg472
+t23 arg473
+t24 arg474
+t25 arg475
+t26 arg476
+t27 arg477
+t28 arg478
+t29 arg479
+t30 arg480
+t31 arg481
+t32 arg482
+t33 arg483
+t34 arg484
+t35 arg485
+t36 arg486
+t37 arg487
+t38 arg488
+t39 arg489
+t40 arg490
+t41 arg491
+t42 arg492
+t43 arg493
+t44 arg494
+t45 arg495
+t46 arg496
+t47 arg497
+t48 arg498
+t49 arg499
+t0 arg500
+t1 arg501
+t2 arg502
+t3 arg503
+t4 arg504
+t5 arg505
+t6 arg506
+t7 arg507
+t8 arg508
+t9 arg509
+t10 arg510
+t11 arg511
+t12 arg512
+t13 arg513
+t14 arg514
+t15 arg515
+t16 arg516
+t17 arg517
+t18 arg518
+t19 arg519
+t20 arg520
+t21 arg521
+t22 arg522
+t23 arg523
+t24 arg524
+t25 arg525
+t26 arg526
+t27 arg527
+t28 arg528
+t29 arg529
+t30 arg530
+t31 arg531
+t32 arg532
+t33 arg533
+t34 arg534
+t35 arg535
+t36 arg536
+t37 arg537
+t38 arg538
+t39 arg539
+t40 arg540
+t41 arg541
+t42 arg542
+t43 arg543
+t44 arg544
+t45 arg545
+t46 arg546
+t47 arg547
+t48 arg548
+t49 arg549
+t0 arg550
+t1 arg551
+t2 arg552
+t3 arg553
+t4 arg554
+t5 arg555
+t6 arg556
+t7 arg557
+t8 arg558
+t9 arg559
+t10 arg560
+t11 arg561
+t12 arg562
+t13 arg563
+t14 arg564
+t15 arg565
+t16 arg566
+t17 arg567
+t18 arg568
+t19 arg569
+t20 arg570
+t21 arg571
+t22 arg572
+t23 arg573
+t24 arg574
+t25 arg575
+t26 arg576
+t27 arg577
+t28 arg578
+t29 arg579
+t30 arg580
+t31 arg581
+t32 arg582
+t33 arg583
+t34 arg584
+t35 arg585
+t36 arg586
+t37 arg587
+t38 arg588
+t39 arg589
+t40 arg590
+t41 arg591
+t42 arg592
+t43 arg593
+t44 arg594
+t45 arg595
+t46 arg596
+t47 arg597
+t48 arg598
+t49 arg599
+t0 arg600
+t1 arg601
+t2 arg602
+t3 arg603
+t4 arg604
+t5 arg605
+t6 arg606
+t7 arg607
+t8 arg608
+t9 arg609
+t10 arg610
+t11 arg611
+t12 arg612
+t13 arg613
+t14 arg614
+t15 arg615
+t16 arg616
+t17 arg617
+t18 arg618
+t19 arg619
+t20 arg620
+t21 arg621
+t22 arg622
+t23 arg623
+t24 arg624
+t25 arg625
+t26 arg626
+t27 arg627
+t28 arg628
+t29 arg629
+t30 arg630
+t31 arg631
+t32 arg632
+t33 arg633
+t34 arg634
+t35 arg635
+t36 arg636
+t37 arg637
+t38 arg638
+t39 arg639
+t40 arg640
+t41 arg641
+t42 arg642
+t43 arg643
+t44 arg644
+t45 arg645
+t46 arg646
+t47 arg647
+t48 arg648
+t49 arg649
+t0 arg650
+t1 arg651
+t2 arg652
+t3 arg653
+t4 arg654
+t5 arg655
+t6 arg656
+t7 arg657
+t8 arg658
+t9 arg659
+t10 arg660
+t11 arg661
+t12 arg662
+t13 arg663
+t14 arg664
+t15 arg665
+t16 arg666
+t17 arg667
+t18 arg668
+t19 arg669
+t20 arg670
+t21 arg671
+t22 arg672
+t23 arg673
+t24 arg674
+t25 arg675
+t26 arg676
+t27 arg677
+t28 arg678
+t29 arg679
+t30 arg680
+t31 arg681
+t32 arg682
+t33 arg683
+t34 arg684
+t35 arg685
+t36 arg686
+t37 arg687
+t38 arg688
+t39 arg689
+t40 arg690
+t41 arg691
+t42 arg692
+t43 arg693
+t44 arg694
+t45 arg695
+t46 arg696
+t47 arg697
+t48 arg698
+t49 arg699
+t0 arg700
+t1 arg701
+t2 arg702
+t3 arg703
+t4 arg704
+t5 arg705
+t6 arg706
+t7 arg707
+t8 arg708
+t9 arg709
+t10 arg710
+t11 arg711
+t12 arg712
+t13 arg713
+t14 arg714
+t15 arg715
+t16 arg716
+t17 arg717
+t18 arg718
+t19 arg719
+t20 arg720
+t21 arg721
+t22 arg722
+t23 arg723
+t24 arg724
+t25 arg725
+t26 arg726
+t27 arg727
+t28 arg728
+t29 arg729
+t30 arg730
+t31 arg731
+t32 arg732
+t33 arg733
+t34 arg734
+t35 arg735
+t36 arg736
+t37 arg737
+t38 arg738
+t39 arg739
+t40 arg740
+t41 arg741
+t42 arg742
+t43 arg743
+t44 arg744
+t45 arg745
+t46 arg746
+t47 arg747
+t48 arg748
+t49 arg749
+t0 arg750
+t1 arg751
+t2 arg752
+t3 arg753
+t4 arg754
+t5 arg755
+t6 arg756
+t7 arg757
+t8 arg758
+t9 arg759
+t10 arg760
+t11 arg761
+t12 arg762
+t13 arg763
+t14 arg764
+t15 arg765
+t16 arg766
+t17 arg767
+t18 arg768
+t19 arg769
+t20 arg770
+t21 arg771
+t22 arg772
+t23 arg773
+t24 arg774
+t25 arg775
+t26 arg776
+t27 arg777
+t28 arg778
+t29 arg779
+t30 arg780
+t31 arg781
+t32 arg782
+t33 arg783
+t34 arg784
+t35 arg785
+t36 arg786
+t37 arg787
+t38 arg788
+t39 arg789
+t40 arg790
+t41 arg791
+t42 arg792
+t43 arg793
+t44 arg794
+t45 arg795
+t46 arg796
+t47 arg797
+t48 arg798
+t49 arg799
+t0 arg800
+t1 arg801
+t2 arg802
+t3 arg803
+t4 arg804
+t5 arg805
+t6 arg806
+t7 arg807
+t8 arg808
+t9 arg809
+t10 arg810
+t11 arg811
+t12 arg812
+t13 arg813
+t14 arg814
+t15 arg815
+t16 arg816
+t17 arg817
+t18 arg818
+t19 arg819
+t20 arg820
+t21 arg821
+t22 arg822
+t23 arg823
+t24 arg824
+t25 arg825
+t26 arg826
+t27 arg827
+t28 arg828
+t29 arg829
+t30 arg830
+t31 arg831
+t32 arg832
+t33 arg833
+t34 arg834
+t35 arg835
+t36 arg836
+t37 arg837
+t38 arg838
+t39 arg839
+t40 arg840
+t41 arg841
+t42 arg842
+t43 arg843
+t44 arg844
+t45 arg845
+t46 arg846
+t47 arg847
+t48 arg848
+t49 arg849
+t0 arg850
+t1 arg851
+t2 arg852
+t3 arg853
+t4 arg854
+t5 arg855
+t6 arg856
+t7 arg857
+t8 arg858
+t9 arg859
+t10 arg860
+t11 arg861
+t12 arg862
+t13 arg863
+t14 arg864
+t15 arg865
+t16 arg866
+t17 arg867
+t18 arg868
+t19 arg869
+t20 arg870
+t21 arg871
+t22 arg872
+t23 arg873
+t24 arg874
+t25 arg875
+t26 arg876
+t27 arg877
+t28 arg878
+t29 arg879
+t30 arg880
+t31 arg881
+t32 arg882
+t33 arg883
+t34 arg884
+t35 arg885
+t36 arg886
+t37 arg887
+t38 arg888
+t39 arg889
+t40 arg890
+t41 arg891
+t42 arg892
+t43 arg893
+t44 arg894
+t45 arg895
+t46 arg896
+t47 arg897
+t48 arg898
+t49 arg899
+t0 arg900
+t1 arg901
+t2 arg902
+t3 arg903
+t4 arg904
+t5 arg905
+t6 arg906
+t7 arg907
+t8 arg908
+t9 arg909
+t10 arg910
+t11 arg911
+t12 arg912
+t13 arg913
+t14 arg914
+t15 arg915
+t16 arg916
+t17 arg917
+t18 arg918
+t19 arg919
+t20 arg920
+t21 arg921
+t22 arg922
+t23 arg923
+t24 arg924
+t25 arg925
+t26 arg926
+t27 arg927
+t28 arg928
+t29 arg929
+t30 arg930
+t31 arg931
+t32 arg932
+t33 arg933
+t34 arg934
+t35 arg935
+t36 arg936
+t37 arg937
+t38 arg938
+t39 arg939
+t40 arg940
+t41 arg941
+t42 arg942
+t43 arg943
+t44 arg944
+t45 arg945
+t46 arg946
+t47 arg947
+t48 arg948
+t49 arg949
+t0 arg950
+t1 arg951
+t2 arg952
+t3 arg953
+t4 arg954
+t5 arg955
+t6 arg956
+t7 arg957
+t8 arg958
+t9 arg959
+t10 arg960
+t11 arg961
+t12 arg962
+t13 arg963
+t14 arg964
+t15 arg965
+t16 arg966
+t17 arg967
+t18 arg968
+t19 arg969
+t20 arg970
+t21 arg971
+t22 arg972
+t23 arg973
+t24 arg974
+t25 arg975
+t26 arg976
+t27 arg977
+t28 arg978
+t29 arg979
+t30 arg980
+t31 arg981
+t32 arg982
+t33 arg983
+t34 arg984
+t35 arg985
+t36 arg986
+t37 arg987
+t38 arg988
+t39 arg989
+t40 arg990
+t41 arg991
+t42 arg992
+t43 arg993
+t44 arg994
+t45 arg995
+t46 arg996
+t47 arg997
+t48 arg998
+t49 arg999
+t0 arg1000
+t1 arg1001
+t2 arg1002
+t3 arg1003
+t4 arg1004
+t5 arg1005
+t6 arg1006
+t7 arg1007
+t8 arg1008
+t9 arg1009
+t10 arg1010
+t11 arg1011
+t12 arg1012
+t13 arg1013
+t14 arg1014
+t15 arg1015
+t16 arg1016
+t17 arg1017
+t18 arg1018
+t19 arg1019
+t20 arg1020
+t21 arg1021
+t22 arg1022
+t23 arg1023
+t24 arg1024
+t25 arg1025
+t26 arg1026
+t27 arg1027
+t28 arg1028
+t29 arg1029
+t30 arg1030
+t31 arg1031
+t32 arg1032
+t33 arg1033
+t34 arg1034
+t35 arg1035
+t36 arg1036
+t37 arg1037
+t38 arg1038
+t39 arg1039
+t40 arg1040
+t41 arg1041
+t42 arg1042
+t43 arg1043
+t44 arg1044
+t45 arg1045
+t46 arg1046
+t47 arg1047
+t48 arg1048
+t49 arg1049
+t0 arg1050
+t1 arg1051
+t2 arg1052
+t3 arg1053
+t4 arg1054
+t5 arg1055
+t6 arg1056
+t7 arg1057
+t8 arg1058
+t9 arg1059
+t10 arg1060
+t11 arg1061
+t12 arg1062
+t13 arg1063
+t14 arg1064
+t15 arg1065
+t16 arg1066
+t17 arg1067
+t18 arg1068
+t19 arg1069
+t20 arg1070
+t21 arg1071
+t22 arg1072
+t23 arg1073
+t24 arg1074
+t25 arg1075
+t26 arg1076
+t27 arg1077
+t28 arg1078
+t29 arg1079
+t30 arg1080
+t31 arg1081
+t32 arg1082
+t33 arg1083
+t34 arg1084
+t35 arg1085
+t36 arg1086
+t37 arg1087
+t38 arg1088
+t39 arg1089
+t40 arg1090
+t41 arg1091
+t42 arg1092
+t43 arg1093
+t44 arg1094
+t45 arg1095
+t46 arg1096
+t47 arg1097
+t48 arg1098
+t49 arg1099
+t0 arg1100
+t1 arg1101
+t2 arg1102
+t3 arg1103
+t4 arg1104
+t5 arg1105
+t6 arg1106
+t7 arg1107
+t8 arg1108
+t9 arg1109
+t10 arg1110
+t11 arg1111
+t12 arg1112
+t13 arg1113
+t14 arg1114
+t15 arg1115
+t16 arg1116
+t17 arg1117
+t18 arg1118
+t19 arg1119
+t20 arg1120
+t21 arg1121
+t22 arg1122
+t23 arg1123
+t24 arg1124
+t25 arg1125
+t26 arg1126
+t27 arg1127
+t28 arg1128
+t29 arg1129
+t30 arg1130
+t31 arg1131
+t32 arg1132
+t33 arg1133
+t34 arg1134
+t35 arg1135
+t36 arg1136
+t37 arg1137
+t38 arg1138
+t39 arg1139
+t40 arg1140
+t41 arg1141
+t42 arg1142
+t43 arg1143
+t44 arg1144
+t45 arg1145
+t46 arg1146
+t47 arg1147
+t48 arg1148
+t49 arg1149
+t0 arg1150
+t1 arg1151
+t2 arg1152
+t3 arg1153
+t4 arg1154
+t5 arg1155
+t6 arg1156
+t7 arg1157
+t8 arg1158
+t9 arg1159
+t10 arg1160
+t11 arg1161
+t12 arg1162
+t13 arg1163
+t14 arg1164
+t15 arg1165
+t16 arg1166
+t17 arg1167
+t18 arg1168
+t19 arg1169
+t20 arg1170
+t21 arg1171
+t22 arg1172
+t23 arg1173
+t24 arg1174
+t25 arg1175
+t26 arg1176
+t27 arg1177
+t28 arg1178
+t29 arg1179
+t30 arg1180
+t31 arg1181
+t32 arg1182
+t33 arg1183
+t34 arg1184
+t35 arg1185
+t36 arg1186
+t37 arg1187
+t38 arg1188
+t39 arg1189
+t40 arg1190
+t41 arg1191
+t42 arg1192
+t43 arg1193
+t44 arg1194
+t45 arg1195
+t46 arg1196
+t47 arg1197
+t48 arg1198
+t49 arg1199
+t0 arg1200
+t1 arg1201
+t2 arg1202
+t3 arg1203
+t4 arg1204
+t5 arg1205
+t6 arg1206
+t7 arg1207
+t8 arg1208
+t9 arg1209
+t10 arg1210
+t11 arg1211
+t12 arg1212
+t13 arg1213
+t14 arg1214
+t15 arg1215
+t16 arg1216
+t17 arg1217
+t18 arg1218
+t19 arg1219
+t20 arg1220
+t21 arg1221
+t22 arg1222
+t23 arg1223
+t24 arg1224
+t25 arg1225
+t26 arg1226
+t27 arg1227
+t28 arg1228
+t29 arg1229
+t30 arg1230
+t31 arg1231
+t32 arg1232
+t33 arg1233
+t34 arg1234
+t35 arg1235
+t36 arg1236
+t37 arg1237
+t38 arg1238
+t39 arg1239
+t40 arg1240
+t41 arg1241
+t42 arg1242
+t43 arg1243
+t44 arg1244
+t45 arg1245
+t46 arg1246
+t47 arg1247
+t48 arg1248
+t49 arg1249
+t0 arg1250
+t1 arg1251
+t2 arg1252
+t3 arg1253
+t4 arg1254
+t5 arg1255
+t6 arg1256
+t7 arg1257
+t8 arg1258
+t9 arg1259
+t10 arg1260
+t11 arg1261
+t12 arg1262
+t13 arg1263
+t14 arg1264
+t15 arg1265
+t16 arg1266
+t17 arg1267
+t18 arg1268
+t19 arg1269
+t20 arg1270
+t21 arg1271
+t22 arg1272
+t23 arg1273
+t24 arg1274
+t25 arg1275
+t26 arg1276
+t27 arg1277
+t28 arg1278
+t29 arg1279
+t30 arg1280
+t31 arg1281
+t32 arg1282
+t33 arg1283
+t34 arg1284
+t35 arg1285
+t36 arg1286
+t37 arg1287
+t38 arg1288
+t39 arg1289
+t40 arg1290
+t41 arg1291
+t42 arg1292
+t43 arg1293
+t44 arg1294
+t45 arg1295
+t46 arg1296
+t47 arg1297
+t48 arg1298
+t49 arg1299
+t0 arg1300
+t1 arg1301
+t2 arg1302
+t3 arg1303
+t4 arg1304
+t5 arg1305
+t6 arg1306
+t7 arg1307
+t8 arg1308
+t9 arg1309
+t10 arg1310
+t11 arg1311
+t12 arg1312
+t13 arg1313
+t14 arg1314
+t15 arg1315
+t16 arg1316
+t17 arg1317
+t18 arg1318
+t19 arg1319
+t20 arg1320
+t21 arg1321
+t22 arg1322
+t23 arg1323
+t24 arg1324
+t25 arg1325
+t26 arg1326
+t27 arg1327
+t28 arg1328
+t29 arg1329
+t30 arg1330
+t31 arg1331
+t32 arg1332
+t33 arg1333
+t34 arg1334
+t35 arg1335
+t36 arg1336
+t37 arg1337
+t38 arg1338
+t39 arg1339
+t40 arg1340
+t41 arg1341
+t42 arg1342
+t43 arg1343
+t44 arg1344
+t45 arg1345
+t46 arg1346
+t47 arg1347
+t48 arg1348
+t49 arg1349
+t0 arg1350
+t1 arg1351
+t2 arg1352
+t3 arg1353
+t4 arg1354
+t5 arg1355
+t6 arg1356
+t7 arg1357
+t8 arg1358
+t9 arg1359
+t10 arg1360
+t11 arg1361
+t12 arg1362
+t13 arg1363
+t14 arg1364
+t15 arg1365
+t16 arg1366
+t17 arg1367
+t18 arg1368
+t19 arg1369
+t20 arg1370
+t21 arg1371
+t22 arg1372
+t23 arg1373
+t24 arg1374
+t25 arg1375
+t26 arg1376
+t27 arg1377
+t28 arg1378
+t29 arg1379
+t30 arg1380
+t31 arg1381
+t32 arg1382
+t33 arg1383
+t34 arg1384
+t35 arg1385
+t36 arg1386
+t37 arg1387
+t38 arg1388
+t39 arg1389
+t40 arg1390
+t41 arg1391
+t42 arg1392
+t43 arg1393
+t44 arg1394
+t45 arg1395
+t46 arg1396
+t47 arg1397
+t48 arg1398
+t49 arg1399
+t0 arg1400
+t1 arg1401
+t2 arg1402
+t3 arg1403
+t4 arg1404
+t5 arg1405
+t6 arg1406
+t7 arg1407
+t8 arg1408
+t9 arg1409
+t10 arg1410
+t11 arg1411
+t12 arg1412
+t13 arg1413
+t14 arg1414
+t15 arg1415
+t16 arg1416
+t17 arg1417
+t18 arg1418
+t19 arg1419
+t20 arg1420
+t21 arg1421
+t22 arg1422
+t23 arg1423
+t24 arg1424
+t25 arg1425
+t26 arg1426
+t27 arg1427
+t28 arg1428
+t29 arg1429
+t30 arg1430
+t31 arg1431
+t32 arg1432
+t33 arg1433
+t34 arg1434
+t35 arg1435
+t36 arg1436
+t37 arg1437
+t38 arg1438
+t39 arg1439
+t40 arg1440
+t41 arg1441
+t42 arg1442
+t43 arg1443
+t44 arg1444
+t45 arg1445
+t46 arg1446
+t47 arg1447
+t48 arg1448
+t49 arg1449
+t0 arg1450
+t1 arg1451
+t2 arg1452
+t3 arg1453
+t4 arg1454
+t5 arg1455
+t6 arg1456
+t7 arg1457
+t8 arg1458
+t9 arg1459
+t10 arg1460
+t11 arg1461
+t12 arg1462
+t13 arg1463
+t14 arg1464
+t15 arg1465
+t16 arg1466
+t17 arg1467
+t18 arg1468
+t19 arg1469
+t20 arg1470
+t21 arg1471
+t22 arg1472
+t23 arg1473
+t24 arg1474
+t25 arg1475
+t26 arg1476
+t27 arg1477
+t28 arg1478
+t29 arg1479
+t30 arg1480
+t31 arg1481
+t32 arg1482
+t33 arg1483
+t34 arg1484
+t35 arg1485
+t36 arg1486
+t37 arg1487
+t38 arg1488
+t39 arg1489
+t40 arg1490
+t41 arg1491
+t42 arg1492
+t43 arg1493
+t44 arg1494
+t45 arg1495
+t46 arg1496
+t47 arg1497
+t48 arg1498
+t49 arg1499
+t0 arg1500
+t1 arg1501
+t2 arg1502
+t3 arg1503
+t4 arg1504
+t5 arg1505
+t6 arg1506
+t7 arg1507
+t8 arg1508
+t9 arg1509
+t10 arg1510
+t11 arg1511
+t12 arg1512
+t13 arg1513
+t14 arg1514
+t15 arg1515
+t16 arg1516
+t17 arg1517
+t18 arg1518
+t19 arg1519
+t20 arg1520
+t21 arg1521
+t22 arg1522
+t23 arg1523
+t24 arg1524
+t25 arg1525
+t26 arg1526
+t27 arg1527
+t28 arg1528
+t29 arg1529
+t30 arg1530
+t31 arg1531
+t32 arg1532
+t33 arg1533
+t34 arg1534
+t35 arg1535
+t36 arg1536
+t37 arg1537
+t38 arg1538
+t39 arg1539
+t40 arg1540
+t41 arg1541
+t42 arg1542
+t43 arg1543
+t44 arg1544
+t45 arg1545
+t46 arg1546
+t47 arg1547
+t48 arg1548
+t49 arg1549
+t0 arg1550
+t1 arg1551
+t2 arg1552
+t3 arg1553
+t4 arg1554
+t5 arg1555
+t6 arg1556
+t7 arg1557
+t8 arg1558
+t9 arg1559
+t10 arg1560
+t11 arg1561
+t12 arg1562
+t13 arg1563
+t14 arg1564
+t15 arg1565
+t16 arg1566
+t17 arg1567
+t18 arg1568
+t19 arg1569
+t20 arg1570
+t21 arg1571
+t22 arg1572
+t23 arg1573
+t24 arg1574
+t25 arg1575
+t26 arg1576
+t27 arg1577
+t28 arg1578
+t29 arg1579
+t30 arg1580
+t31 arg1581
+t32 arg1582
+t33 arg1583
+t34 arg1584
+t35 arg1585
+t36 arg1586
+t37 arg1587
+t38 arg1588
+t39 arg1589
+t40 arg1590
+t41 arg1591
+t42 arg1592
+t43 arg1593
+t44 arg1594
+t45 arg1595
+t46 arg1596
+t47 arg1597
+t48 arg1598
+t49 arg1599
+t0 arg1600
+t1 arg1601
+t2 arg1602
+t3 arg1603
+t4 arg1604
+t5 arg1605
+t6 arg1606
+t7 arg1607
+t8 arg1608
+t9 arg1609
+t10 arg1610
+t11 arg1611
+t12 arg1612
+t13 arg1613
+t14 arg1614
+t15 arg1615
+t16 arg1616
+t17 arg1617
+t18 arg1618
+t19 arg1619
+t20 arg1620
+t21 arg1621
+t22 arg1622
+t23 arg1623
+t24 arg1624
+t25 arg1625
+t26 arg1626
+t27 arg1627
+t28 arg1628
+t29 arg1629
+t30 arg1630
+t31 arg1631
+t32 arg1632
+t33 arg1633
+t34 arg1634
+t35 arg1635
+t36 arg1636
+t37 arg1637
+t38 arg1638
+t39 arg1639
+t40 arg1640
+t41 arg1641
+t42 arg1642
+t43 arg1643
+t44 arg1644
+t45 arg1645
+t46 arg1646
+t47 arg1647
+t48 arg1648
+t49 arg1649
+t0 arg1650
+t1 arg1651
+t2 arg1652
+t3 arg1653
+t4 arg1654
+t5 arg1655
+t6 arg1656
+t7 arg1657
+t8 arg1658
+t9 arg1659
+t10 arg1660
+t11 arg1661
+t12 arg1662
+t13 arg1663
+t14 arg1664
+t15 arg1665
+t16 arg1666
+t17 arg1667
+t18 arg1668
+t19 arg1669
+t20 arg1670
+t21 arg1671
+t22 arg1672
+t23 arg1673
+t24 arg1674
+t25 arg1675
+t26 arg1676
+t27 arg1677
+t28 arg1678
+t29 arg1679
+t30 arg1680
+t31 arg1681
+t32 arg1682
+t33 arg1683
+t34 arg1684
+t35 arg1685
+t36 arg1686
+t37 arg1687
+t38 arg1688
+t39 arg1689
+t40 arg1690
+t41 arg1691
+t42 arg1692
+t43 arg1693
+t44 arg1694
+t45 arg1695
+t46 arg1696
+t47 arg1697
+t48 arg1698
+t49 arg1699
+t0 arg1700
+t1 arg1701
+t2 arg1702
+t3 arg1703
+t4 arg1704
+t5 arg1705
+t6 arg1706
+t7 arg1707
+t8 arg1708
+t9 arg1709
+t10 arg1710
+t11 arg1711
+t12 arg1712
+t13 arg1713
+t14 arg1714
+t15 arg1715
+t16 arg1716
+t17 arg1717
+t18 arg1718
+t19 arg1719
+t20 arg1720
+t21 arg1721
+t22 arg1722
+t23 arg1723
+t24 arg1724
+t25 arg1725
+t26 arg1726
+t27 arg1727
+t28 arg1728
+t29 arg1729
+t30 arg1730
+t31 arg1731
+t32 arg1732
+t33 arg1733
+t34 arg1734
+t35 arg1735
+t36 arg1736
+t37 arg1737
+t38 arg1738
+t39 arg1739
+t40 arg1740
+t41 arg1741
+t42 arg1742
+t43 arg1743
+t44 arg1744
+t45 arg1745
+t46 arg1746
+t47 arg1747
+t48 arg1748
+t49 arg1749
+t0 arg1750
+t1 arg1751
+t2 arg1752
+t3 arg1753
+t4 arg1754
+t5 arg1755
+t6 arg1756
+t7 arg1757
+t8 arg1758
+t9 arg1759
+t10 arg1760
+t11 arg1761
+t12 arg1762
+t13 arg1763
+t14 arg1764
+t15 arg1765
+t16 arg1766
+t17 arg1767
+t18 arg1768
+t19 arg1769
+t20 arg1770
+t21 arg1771
+t22 arg1772
+t23 arg1773
+t24 arg1774
+t25 arg1775
+t26 arg1776
+t27 arg1777
+t28 arg1778
+t29 arg1779
+t30 arg1780
+t31 arg1781
+t32 arg1782
+t33 arg1783
+t34 arg1784
+t35 arg1785
+t36 arg1786
+t37 arg1787
+t38 arg1788
+t39 arg1789
+t40 arg1790
+t41 arg1791
+t42 arg1792
+t43 arg1793
+t44 arg1794
+t45 arg1795
+t46 arg1796
+t47 arg1797
+t48 arg1798
+t49 arg1799
+t0 arg1800
+t1 arg1801
+t2 arg1802
+t3 arg1803
+t4 arg1804
+t5 arg1805
+t6 arg1806
+t7 arg1807
+t8 arg1808
+t9 arg1809
+t10 arg1810
+t11 arg1811
+t12 arg1812
+t13 arg1813
+t14 arg1814
+t15 arg1815
+t16 arg1816
+t17 arg1817
+t18 arg1818
+t19 arg1819
+t20 arg1820
+t21 arg1821
+t22 arg1822
+t23 arg1823
+t24 arg1824
+t25 arg1825
+t26 arg1826
+t27 arg1827
+t28 arg1828
+t29 arg1829
+t30 arg1830
+t31 arg1831
+t32 arg1832
+t33 arg1833
+t34 arg1834
+t35 arg1835
+t36 arg1836
+t37 arg1837
+t38 arg1838
+t39 arg1839
+t40 arg1840
+t41 arg1841
+t42 arg1842
+t43 arg1843
+t44 arg1844
+t45 arg1845
+t46 arg1846
+t47 arg1847
+t48 arg1848
+t49 arg1849
+t0 arg1850
+t1 arg1851
+t2 arg1852
+t3 arg1853
+t4 arg1854
+t5 arg1855
+t6 arg1856
+t7 arg1857
+t8 arg1858
+t9 arg1859
+t10 arg1860
+t11 arg1861
+t12 arg1862
+t13 arg1863
+t14 arg1864
+t15 arg1865
+t16 arg1866
+t17 arg1867
+t18 arg1868
+t19 arg1869
+t20 arg1870
+t21 arg1871
+t22 arg1872
+t23 arg1873
+t24 arg1874
+t25 arg1875
+t26 arg1876
+t27 arg1877
+t28 arg1878
+t29 arg1879
+t30 arg1880
+t31 arg1881
+t32 arg1882
+t33 arg1883
+t34 arg1884
+t35 arg1885
+t36 arg1886
+t37 arg1887
+t38 arg1888
+t39 arg1889
+t40 arg1890
+t41 arg1891
+t42 arg1892
+t43 arg1893
+t44 arg1894
+t45 arg1895
+t46 arg1896
+t47 arg1897
+t48 arg1898
+t49 arg1899
+t0 arg1900
+t1 arg1901
+t2 arg1902
+t3 arg1903
+t4 arg1904
+t5 arg1905
+t6 arg1906
+t7 arg1907
+t8 arg1908
+t9 arg1909
+t10 arg1910
+t11 arg1911
+t12 arg1912
+t13 arg1913
+t14 arg1914
+t15 arg1915
+t16 arg1916
+t17 arg1917
+t18 arg1918
+t19 arg1919
+t20 arg1920
+t21 arg1921
+t22 arg1922
+t23 arg1923
+t24 arg1924
+t25 arg1925
+t26 arg1926
+t27 arg1927
+t28 arg1928
+t29 arg1929
+t30 arg1930
+t31 arg1931
+t32 arg1932
+t33 arg1933
+t34 arg1934
+t35 arg1935
+t36 arg1936
+t37 arg1937
+t38 arg1938
+t39 arg1939
+t40 arg1940
+t41 arg1941
+t42 arg1942
+t43 arg1943
+t44 arg1944
+t45 arg1945
+t46 arg1946
+t47 arg1947
+t48 arg1948
+t49 arg1949
+t0 arg1950
+t1 arg1951
+t2 arg1952
+t3 arg1953
+t4 arg1954
+t5 arg1955
+t6 arg1956
+t7 arg1957
+t8 arg1958
+t9 arg1959
+t10 arg1960
+t11 arg1961
+t12 arg1962
+t13 arg1963
+t14 arg1964
+t15 arg1965
+t16 arg1966
+t17 arg1967
+t18 arg1968
+t19 arg1969
+t20 arg1970
+t21 arg1971
+t22 arg1972
+t23 arg1973
+t24 arg1974
+t25 arg1975
+t26 arg1976
+t27 arg1977
+t28 arg1978
+t29 arg1979
+t30 arg1980
+t31 arg1981
+t32 arg1982
+t33 arg1983
+t34 arg1984
+t35 arg1985
+t36 arg1986
+t37 arg1987
+t38 arg1988
+t39 arg1989
+t40 arg1990
+t41 arg1991
+t42 arg1992
+t43 arg1993
+t44 arg1994
+t45 arg1995
+t46 arg1996
+t47 arg1997
+t48 arg1998
+t49 arg1999
@@ -0,0 +1,2000 @@
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
+/bin/echo pipeline | /bin/cat | /bin/cat | /bin/cat
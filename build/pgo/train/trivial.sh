@@ -0,0 +1,2000 @@
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
+/bin/true
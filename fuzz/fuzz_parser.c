@@ -0,0 +1,108 @@
+/*
+ * Fuzz target for the tokenizer, the command list parser and alias expansion.
+ *
+ * Exposes the libFuzzer entry point LLVMFuzzerTestOneInput, so it can be
+ * linked with -fsanitize=fuzzer (libFuzzer, or AFL++'s afl-clang-fast which
+ * accepts the same harness), or with fuzz/perf_driver.c which feeds inputs
+ * from files/stdin and checks how the parse cost scales with input size.
+ * Parameter expansion is not called: $(...) would run the fuzzed input.
+ *
+ * fuzz_input_valid tells the driver whether the last input was parsed to
+ * the end, so inputs that stop at a syntax error are not timed as if the
+ * parser had gone through them.
+ */
+#include "../include/wsh.h"
+#include "../include/hash_map.h"
+#include "../include/dynamic_array.h"
+#include "../include/parser.h"
+#include "../include/tokenizer.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern HashMap *alias_hm;
+extern DynamicArray *history_da;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+int fuzz_input_valid(void);
+
+/* Whether the tokenizer and the command list parser both reached the end
+   of the last input */
+static int last_input_valid;
+
+/* Aliases that fuzzed command names can hit, including ones that expand
+   to nothing, to quotes and to a full MAX_ARGS line */
+static void fuzz_init(void)
+{
+  static char long_alias[2 * MAX_ARGS + 1];
+
+  alias_hm = hm_create();
+  history_da = da_create(0);
+
+  for (int i = 0; i < MAX_ARGS; i++)
+  {
+    long_alias[2 * i] = 'x';
+    long_alias[2 * i + 1] = ' ';
+  }
+  long_alias[2 * MAX_ARGS] = '\0';
+
+  hm_put(alias_hm, "a", "ls -l");
+  hm_put(alias_hm, "e", " ");
+  hm_put(alias_hm, "q", "echo 'quoted arg' '");
+  hm_put(alias_hm, "l", long_alias);
+  hm_put(alias_hm, "a'", "'a");
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+  if (!alias_hm)
+    fuzz_init();
+
+  /* The parser works on C strings: stop at the first NUL */
+  char *cmdline = malloc(size + 1);
+  if (!cmdline)
+    return 0;
+  memcpy(cmdline, data, size);
+  cmdline[size] = '\0';
+  size_t len = strlen(cmdline);
+
+  /* Split with room for every word, so a long line is tokenized to the
+     end instead of stopping at MAX_ARGS */
+  TokSpan *spans = malloc((len + 1) * sizeof(*spans));
+  if (!spans)
+  {
+    free(cmdline);
+    return 0;
+  }
+  int words = tok_split(cmdline, len, spans, (int)len + 1);
+  free(spans);
+
+  SimpleCommand cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  parseline_no_subst(cmdline, cmd.argv, cmd.expand, &cmd.argc);
+  if (cmd.argc > 0)
+  {
+    expand_alias(&cmd);
+  }
+  free_argv(cmd.argv, cmd.argc);
+
+  CommandList list;
+  int parsed = parse_command_list(cmdline, &list) == 0;
+  if (parsed)
+  {
+    for (int i = 0; i < list.count; i++)
+      for (int j = 0; j < list.items[i].ncmds; j++)
+        expand_alias(&list.items[i].cmds[j]);
+    command_list_free(&list);
+  }
+
+  last_input_valid = words >= 0 && parsed;
+  free(cmdline);
+  return 0;
+}
+
+int fuzz_input_valid(void)
+{
+  return last_input_valid;
+}
@@ -0,0 +1,206 @@
+/*
+ * Standalone driver for fuzz targets that expose LLVMFuzzerTestOneInput.
+ *
+ * Without file arguments it reads one input from stdin and runs it once,
+ * which is the interface AFL expects from an instrumented binary.
+ *
+ * With file arguments (e.g. a corpus directory expanded by the shell) it
+ * measures each input: the cost of one run, and how the cost grows when the
+ * input is repeated to 16x its size. The copies are joined into one line
+ * that still parses: as a list (" ; ") when that is valid, else end to end,
+ * which lengthens the words instead (e.g. runs of quotes). Inputs that stop
+ * at a parse error whichever way they are joined are reported as not
+ * measured, since their cost says nothing about the parser's growth; this
+ * needs the target to define fuzz_input_valid. The growth is reported as an
+ * exponent (1.0 = linear); inputs above the limit are flagged and make the
+ * driver exit with status 1, so the parser's worst case can be kept linear.
+ *
+ * Usage: fuzz_parser_perf [-e max_exponent] [file...]
+ */
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/* Whether the last input was parsed to the end (optional in the target) */
+int fuzz_input_valid(void) __attribute__((weak));
+
+#define MIN_SCALED_SIZE 16384 /* smallest input used for the growth check */
+#define GROWTH_FACTOR 16     /* size ratio between the two growth samples */
+#define MIN_SAMPLE_NS 2e6    /* time each sample for at least 2ms */
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Mean nanoseconds per run of the target on the given input */
+static double time_input(const uint8_t *data, size_t size)
+{
+  size_t reps = 1;
+  for (;;)
+  {
+    double start = now_ns();
+    for (size_t i = 0; i < reps; i++)
+      LLVMFuzzerTestOneInput(data, size);
+    double elapsed = now_ns() - start;
+    if (elapsed >= MIN_SAMPLE_NS || reps >= (1u << 24))
+      return elapsed / reps;
+    reps *= 2;
+  }
+}
+
+/* Join `times` copies of data with sep; the length goes to *out_size */
+static uint8_t *repeat_input(const uint8_t *data, size_t size, size_t times,
+                             const char *sep, size_t *out_size)
+{
+  size_t sep_len = strlen(sep);
+  *out_size = times * size + (times - 1) * sep_len;
+  uint8_t *out = malloc(*out_size);
+  if (!out)
+  {
+    perror("malloc");
+    exit(EXIT_FAILURE);
+  }
+  uint8_t *p = out;
+  for (size_t i = 0; i < times; i++)
+  {
+    if (i > 0)
+    {
+      memcpy(p, sep, sep_len);
+      p += sep_len;
+    }
+    memcpy(p, data, size);
+    p += size;
+  }
+  return out;
+}
+
+/* Whether the target parses the input to the end */
+static int parses(const uint8_t *data, size_t size)
+{
+  LLVMFuzzerTestOneInput(data, size);
+  return !fuzz_input_valid || fuzz_input_valid();
+}
+
+/* Read a whole stream into memory */
+static uint8_t *read_all(FILE *fp, size_t *size)
+{
+  size_t cap = 4096, len = 0;
+  uint8_t *buf = malloc(cap);
+  size_t n;
+  while (buf && (n = fread(buf + len, 1, cap - len, fp)) > 0)
+  {
+    len += n;
+    if (len == cap)
+    {
+      cap *= 2;
+      uint8_t *new_buf = realloc(buf, cap);
+      if (!new_buf)
+        free(buf);
+      buf = new_buf;
+    }
+  }
+  if (!buf)
+  {
+    perror("malloc");
+    exit(EXIT_FAILURE);
+  }
+  *size = len;
+  return buf;
+}
+
+/* Time one input and its scaled-up copies; returns 1 if it is flagged */
+static int measure(const char *name, const uint8_t *data, size_t size, double max_exponent)
+{
+  static const char *const separators[] = {" ; ", ""};
+
+  double single = time_input(data, size);
+
+  /* Copies are joined within one line: drop the newline ending each */
+  size_t unit = size;
+  if (unit > 0 && data[unit - 1] == '\n')
+    unit--;
+  if (unit == 0)
+  {
+    printf("%-40s %8zu %12.0f %9s\n", name, size, single, "-");
+    return 0;
+  }
+
+  size_t base = (MIN_SCALED_SIZE + unit - 1) / unit;
+  uint8_t *small = NULL, *large = NULL;
+  size_t small_size = 0, large_size = 0;
+  for (size_t i = 0; i < sizeof(separators) / sizeof(*separators); i++)
+  {
+    small = repeat_input(data, unit, base, separators[i], &small_size);
+    large = repeat_input(data, unit, base * GROWTH_FACTOR, separators[i], &large_size);
+    if (parses(small, small_size) && parses(large, large_size))
+      break;
+    free(small);
+    free(large);
+    small = large = NULL;
+  }
+  if (!small)
+  {
+    printf("%-40s %8zu %12.0f %9s  not measured (parse error)\n", name, size, single, "-");
+    return 0;
+  }
+
+  double t_small = time_input(small, small_size);
+  double t_large = time_input(large, large_size);
+  free(small);
+  free(large);
+
+  double exponent = log(t_large / t_small) / log((double)large_size / small_size);
+  int flagged = exponent > max_exponent;
+  printf("%-40s %8zu %12.0f %9.2f%s\n", name, size, single, exponent,
+         flagged ? "  SUPERLINEAR" : "");
+  return flagged;
+}
+
+int main(int argc, char **argv)
+{
+  double max_exponent = 1.5;
+  int first = 1;
+  if (argc > 2 && strcmp(argv[1], "-e") == 0)
+  {
+    max_exponent = atof(argv[2]);
+    first = 3;
+  }
+
+  size_t size;
+  if (first >= argc)
+  {
+    uint8_t *data = read_all(stdin, &size);
+    LLVMFuzzerTestOneInput(data, size);
+    free(data);
+    return EXIT_SUCCESS;
+  }
+
+  /* Parse errors are expected for most inputs; keep them off the report */
+  if (!freopen("/dev/null", "w", stderr))
+    return EXIT_FAILURE;
+
+  int flagged = 0;
+  printf("%-40s %8s %12s %9s\n", "input", "bytes", "ns/run", "exponent");
+  for (int i = first; i < argc; i++)
+  {
+    FILE *fp = fopen(argv[i], "rb");
+    if (!fp)
+    {
+      printf("%-40s cannot open\n", argv[i]);
+      continue;
+    }
+    uint8_t *data = read_all(fp, &size);
+    fclose(fp);
+    flagged |= measure(argv[i], data, size, max_exponent);
+    free(data);
+  }
+  return flagged ? EXIT_FAILURE : EXIT_SUCCESS;
+}
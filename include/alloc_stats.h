@@ -0,0 +1,64 @@
+#ifndef ALLOC_STATS_H
+#define ALLOC_STATS_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/*
+ * Allocation counters filled in by the allocator shim in alloc_stats.c.
+ * The shim is only active in binaries linked with ALLOC_WRAP_LDFLAGS
+ * (see Makefile), which redirects malloc/calloc/realloc/free/strdup/
+ * strndup calls made by our own objects to the __wrap_* functions.
+ *
+ * When compiled with WSH_PROF (the wsh-prof target) the shim also tracks
+ * live and peak memory and attributes every block to the subsystem that
+ * was active when it was allocated (see ALLOC_SCOPE).
+ */
+typedef enum {
+  ALLOC_OTHER,
+  ALLOC_PARSER,
+  ALLOC_HISTORY,
+  ALLOC_ALIAS,
+  ALLOC_PATH,
+  ALLOC_NUM_SUBSYS
+} AllocSubsys;
+
+typedef struct {
+  size_t allocs;  // Number of successful allocations (realloc counts as one)
+  size_t frees;   // Number of non-NULL frees
+  size_t bytes;   // Total bytes requested
+  size_t live;    // Bytes currently allocated (WSH_PROF only)
+  size_t peak;    // Highest value of live (WSH_PROF only)
+} AllocStats;
+
+// Snapshot of the counters of all subsystems since start (or the last reset)
+AllocStats alloc_stats_get(void);
+
+// Snapshot of the counters of a single subsystem
+AllocStats alloc_stats_subsys(AllocSubsys subsys);
+
+// Reset all counters to zero
+void alloc_stats_reset(void);
+
+// Print a per-subsystem table of the counters
+void alloc_stats_report(FILE *out);
+
+// Make `subsys` the owner of new allocations; returns the previous owner
+AllocSubsys alloc_subsys_enter(AllocSubsys subsys);
+
+// Restore the owner saved by alloc_subsys_enter
+void alloc_subsys_leave(AllocSubsys *prev);
+
+/*
+ * Attribute allocations to `subsys` until the end of the enclosing block.
+ * Compiles to nothing outside of WSH_PROF builds.
+ */
+#ifdef WSH_PROF
+#define ALLOC_SCOPE(subsys) \
+  AllocSubsys alloc_scope_prev_ __attribute__((cleanup(alloc_subsys_leave), unused)) = \
+      alloc_subsys_enter(subsys)
+#else
+#define ALLOC_SCOPE(subsys) ((void)0)
+#endif
+
+#endif // ALLOC_STATS_H
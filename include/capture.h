@@ -0,0 +1,44 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "strbuf.h"
+
+// Output kept in memory per stream; the rest is spilled to a memfd
+#define CAPTURE_MEM_BYTES (64 * 1024)
+
+// Most bytes moved into the memfd per wakeup
+#define CAPTURE_SPILL_CHUNK (1024 * 1024)
+
+// Output of a command read from a pipe the shell owns: the first
+// CAPTURE_MEM_BYTES in memory, anything past that in an anonymous memfd
+typedef struct {
+  int fd;          // Read end of the pipe (-1 once at end of file)
+  int watch;       // Event loop watch on fd
+  StrBuf mem;
+  int spill_fd;    // memfd holding the bytes past mem (-1: none)
+  off_t spilled;   // Bytes in it
+  void *map;       // spill_fd mapped for writing out (NULL until then)
+} Capture;
+
+// Start capturing: returns the write end of the pipe (close-on-exec, for
+// the command's stdout or stderr), or -1; the event loop fills c until
+// the last copy of the write end is closed
+int capture_open(Capture *c);
+
+// Whether the pipe has reached end of file
+int capture_done(const Capture *c);
+
+// Whether anything was captured
+int capture_empty(const Capture *c);
+
+// Write the captures of n commands to fd in order, with as few writev
+// calls as IOV_MAX allows; -1 (errno set) if a write fails
+int capture_write(int fd, Capture *const *caps, int n);
+
+// Stop capturing and release the buffers
+void capture_free(Capture *c);
+
+#endif // CAPTURE_H
@@ -0,0 +1,35 @@
+#ifndef COMPLETION_H
+#define COMPLETION_H
+
+#include <stddef.h>
+
+// Most candidates returned for listing
+#define COMPLETION_LIST_MAX 256
+
+// Result of completing the word before the cursor
+typedef struct {
+  char *insert;     // Text to insert at the cursor ("" if none)
+  char **matches;   // Candidates to list when nothing could be inserted
+  size_t nmatches;
+  size_t total;     // Number of candidates (may exceed nmatches)
+} Completion;
+
+// Start tracking command names (builtins and aliases are added by the
+// caller, PATH executables come from the PATH index)
+void completion_init(void);
+
+// Add or remove one source of a command name
+void completion_add_command(const char *name);
+void completion_remove_command(const char *name);
+
+// Complete the word ending at cursor: a command name in command position,
+// otherwise a file name
+void complete_line(const char *line, size_t cursor, Completion *c);
+
+// Free a completion result
+void completion_result_free(Completion *c);
+
+// Stop tracking command names
+void completion_free(void);
+
+#endif // COMPLETION_H
@@ -1,3 +1,6 @@
+#ifndef DYNAMIC_ARRAY_H
+#define DYNAMIC_ARRAY_H
+
 #include <unistd.h>
 
 typedef struct {
@@ -23,3 +26,5 @@ void da_print(DynamicArray *da);
 
 // Free whole DynamicArray
 void da_free(DynamicArray *da);
+
+#endif // DYNAMIC_ARRAY_H
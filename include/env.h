@@ -0,0 +1,37 @@
+#ifndef ENV_H
+#define ENV_H
+
+#include <sys/types.h>
+
+/*
+ * The shell's environment: a hash map owned by wsh (the process environment
+ * is only read once, at startup) with a version bumped on every change.
+ * Programs are started with a prebuilt envp array that is shared by every
+ * exec until the next change, after which the next exec builds a new one.
+ */
+
+// Take over the variables of envp (the process environment)
+void env_init(char **envp);
+
+// Process ID of the shell as recorded by env_init, the same in every child
+// it forks (getpid() before env_init)
+pid_t env_shell_pid(void);
+
+// Value of a variable (NULL if unset); before env_init this is getenv
+const char *env_get(const char *name);
+
+// Set or remove a variable
+void env_set(const char *name, const char *value);
+void env_unset(const char *name);
+
+// Number of changes made so far
+unsigned long env_version(void);
+
+// NULL terminated NAME=VALUE array for execve, rebuilt only after a change;
+// it stays valid until the next change
+char **env_envp(void);
+
+// Release the environment
+void env_free(void);
+
+#endif // ENV_H
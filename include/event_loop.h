@@ -0,0 +1,54 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <poll.h>
+#include <sys/types.h>
+
+// Readiness passed to ev_watch_fd and reported to its callback
+#define EV_READ POLLIN
+#define EV_WRITE POLLOUT
+#define EV_HUP POLLHUP  // Reported only: the other end is closed
+#define EV_ERR POLLERR  // Reported only: the descriptor cannot be watched
+
+// Called while fd is ready; a watch that is not cancelled is called again
+// as long as fd stays ready
+typedef void (*ev_fd_fn)(int fd, unsigned events, void *data);
+
+// Called once child pid has exited and been reaped (status as from
+// waitpid, -1 if it could not be collected)
+typedef void (*ev_child_fn)(pid_t pid, int status, void *data);
+
+// Called once the timer expires
+typedef void (*ev_timer_fn)(void *data);
+
+// Watch fd for events; returns an id for ev_cancel, or -1
+int ev_watch_fd(int fd, unsigned events, ev_fd_fn fn, void *data);
+
+// Reap child pid when it exits and call fn; returns an id, or -1
+int ev_watch_child(pid_t pid, ev_child_fn fn, void *data);
+
+// Call fn once, ms milliseconds from now; returns an id, or -1
+int ev_add_timer(int ms, ev_timer_fn fn, void *data);
+
+// Remove a watch or timer (a no-op if it already fired or id is -1)
+void ev_cancel(int id);
+
+// Wait up to timeout_ms (-1: no limit) for a source to be ready and run
+// the callbacks of every ready source; returns how many ran, or -1
+int ev_run_once(int timeout_ms);
+
+// Run the loop until fd is readable (1) or timeout_ms passes (0); 1 at
+// once if there is no loop, so a read blocks instead
+int ev_wait_readable(int fd, int timeout_ms);
+
+// Run the loop until child pid exits (just waitpid while the loop has
+// nothing else to watch); 0 with its waitpid status, or -1
+int ev_wait_child(pid_t pid, int *status);
+
+// Name of the mechanism the loop waits with ("io_uring", "epoll", "none")
+const char *ev_backend(void);
+
+// Close the loop and drop every source
+void ev_free(void);
+
+#endif // EVENT_LOOP_H
@@ -0,0 +1,17 @@
+#ifndef EXPAND_H
+#define EXPAND_H
+
+#include "parser.h"
+
+// Expand $NAME, ${NAME}, $?, $$ and $(command) in word in one
+// left-to-right pass; returns a malloc'd string (unset variables expand to
+// nothing, command output loses its trailing newlines)
+char *expand_word(const char *word);
+
+// Expand the arguments and file names of cmd that the lexer flagged;
+// command output is split into arguments at blanks and newlines and
+// arguments that expand to nothing are dropped; -1 (after a warning) if
+// the result has more than MAX_ARGS arguments
+int expand_command(SimpleCommand *cmd);
+
+#endif // EXPAND_H
@@ -1,18 +1,27 @@
 #ifndef HASH_MAP_H
 #define HASH_MAP_H
 
+#include <stddef.h>
+
 #define TABLE_SIZE 101  // prime number for better hashing
+#define HM_INDEX_LEVELS 16  // levels of the sorted index (enough for 4^16 keys)
 
 // Entry in the key-value store
 typedef struct Entry{
     char *key;
     char *value;
     struct Entry *next;  // for chaining
+    int level;  // number of index levels the entry is linked on
+    struct Entry *forward[];  // next entry in key order on each level
 } Entry;
 
-// Hash table
+// Hash table, with a skiplist over the same entries that keeps them
+// sorted by key as they are put and deleted
 typedef struct {
     Entry *buckets[TABLE_SIZE];
+    Entry *index[HM_INDEX_LEVELS];  // first entry on each index level
+    int levels;  // index levels in use
+    unsigned long long rng;  // state for choosing entry levels
 } HashMap;
 
 // Create a new HashMap
@@ -30,8 +39,16 @@ void hm_delete(HashMap *hm, const char *key);
 // Print the Key Value pairs in the HashMap
 void hm_print(const HashMap *hm);
 
-// Print the Key Value pairs in sorted order by Key
-void hm_print_sorted(const HashMap *hm);
+// First entry in key order whose key is not less than key (NULL if none);
+// later entries follow through forward[0]
+Entry *hm_lower_bound(const HashMap *hm, const char *key);
+
+// Print the Key Value pairs whose key starts with prefix (all if NULL)
+// in sorted order by Key
+void hm_print_sorted(const HashMap *hm, const char *prefix);
+
+// Order-independent digest of all key-value pairs
+unsigned long long hm_digest(const HashMap *hm);
 
 // Reset HashMap
 void hm_reset(HashMap *hm);
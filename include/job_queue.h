@@ -0,0 +1,54 @@
+#ifndef JOB_QUEUE_H
+#define JOB_QUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One position of the ring; seq says whose turn it is (see job_queue.c)
+typedef struct {
+  size_t seq;
+  void *item;
+} JobCell;
+
+// Futex word bumped on every change a waiting thread may care about
+typedef struct {
+  uint32_t seq;
+  uint32_t waiters;
+} JobEvent;
+
+// Bounded queue of pointers: one producer, any number of consumers,
+// no locks on the way in or out. Only a thread that finds the queue
+// empty (or full) sleeps, on a futex.
+typedef struct {
+  JobCell *cells;
+  size_t mask;  // Capacity - 1 (the capacity is a power of two)
+  size_t tail __attribute__((aligned(64)));  // Next position to fill (producer)
+  size_t head __attribute__((aligned(64)));  // Next position to take (consumers)
+  JobEvent pushed __attribute__((aligned(64)));  // Item added or queue closed
+  JobEvent popped;  // Item taken or queue closed
+  int closed;
+} JobQueue;
+
+// Create a queue holding up to capacity items (rounded up to a power of two)
+JobQueue *jq_create(size_t capacity);
+
+// Producer: add item, or return -1 if the queue is full
+int jq_try_push(JobQueue *q, void *item);
+
+// Producer: add item, waiting while the queue is full; -1 if it was closed
+int jq_push(JobQueue *q, void *item);
+
+// Consumer: take the oldest item, or NULL if the queue is empty
+void *jq_try_pop(JobQueue *q);
+
+// Consumer: take the oldest item, waiting while the queue is empty; NULL
+// once it is closed and empty
+void *jq_pop(JobQueue *q);
+
+// Either side: no more items will be pushed; wakes every waiting thread
+void jq_close(JobQueue *q);
+
+// Free the queue (the items left in it are not freed)
+void jq_free(JobQueue *q);
+
+#endif // JOB_QUEUE_H
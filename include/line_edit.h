@@ -0,0 +1,11 @@
+#ifndef LINE_EDIT_H
+#define LINE_EDIT_H
+
+#include "dynamic_array.h"
+
+// Read one line from the terminal with editing, history (up and down keys
+// over history) and tab completion; returns a malloc'd line of any length
+// ending in '\n', or NULL at end of input
+char *line_edit_read(const char *prompt, const DynamicArray *history);
+
+#endif // LINE_EDIT_H
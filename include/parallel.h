@@ -0,0 +1,23 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+// Largest number of lines `wsh -j` runs at once
+#define PARALLEL_MAX_JOBS 1024
+
+// Parsed lines the reader thread may get ahead of the line being started
+#define PARALLEL_QUEUE_LINES 256
+
+// Jobs whose output may wait, per job slot, for the lines before them
+// to finish (wsh -j jobs -k)
+#define PARALLEL_CAPTURE_WINDOW 4
+
+// Run a batch script with up to jobs lines at once (wsh -j jobs script),
+// writing the output of each line in order if keep_order is set; returns
+// the result of the last line, as batch_main does
+int parallel_batch_main(const char *script_file, int jobs, int keep_order);
+
+// Stop the reader thread and release the script and the captured output
+// (called by batch_free)
+void parallel_batch_free(void);
+
+#endif // PARALLEL_H
@@ -0,0 +1,59 @@
+#ifndef PARSER_H
+#define PARSER_H
+
+#include "wsh.h"
+
+// Bits of SimpleCommand.expand_redirs
+#define EXPAND_IN 1
+#define EXPAND_OUT 2
+#define EXPAND_ERR 4
+
+// A command with its arguments and redirections
+typedef struct SimpleCommand {
+  char *argv[MAX_ARGS + 1];  // NULL terminated
+  int argc;
+  unsigned char expand[MAX_ARGS];  // Whether argv[i] needs parameter expansion
+  char *in_path;    // < file (NULL if not redirected)
+  char *out_path;   // > file or >> file
+  int out_append;   // Whether out_path was given with >>
+  char *err_path;   // 2> file or 2>> file
+  int err_append;   // Whether err_path was given with 2>>
+  unsigned char expand_redirs;  // EXPAND_* bits of the file names needing expansion
+} SimpleCommand;
+
+// Operator joining a pipeline to the next one in a list
+typedef enum {
+  LIST_END,  // Last pipeline of the list
+  LIST_SEQ,  // ;
+  LIST_AND,  // &&
+  LIST_OR    // ||
+} ListOp;
+
+// Commands connected by |
+typedef struct Pipeline {
+  SimpleCommand *cmds;
+  int ncmds;
+  int capacity;
+  ListOp next_op;
+} Pipeline;
+
+// Pipelines connected by ;, && and ||
+typedef struct CommandList {
+  Pipeline *items;
+  int count;
+  int capacity;
+} CommandList;
+
+// Parse a command line into a list (0 on success, -1 after a warning)
+int parse_command_list(const char *cmdline, CommandList *list);
+
+// Same as parse_command_list, but syntax errors are not reported
+int parse_command_list_quiet(const char *cmdline, CommandList *list);
+
+// Free everything owned by a pipeline
+void pipeline_free(Pipeline *pl);
+
+// Free every pipeline of a list
+void command_list_free(CommandList *list);
+
+#endif // PARSER_H
@@ -0,0 +1,34 @@
+#ifndef PATH_INDEX_H
+#define PATH_INDEX_H
+
+// Most PATH directories the index covers (longer PATHs are searched)
+#define PATH_INDEX_MAX_DIRS 64
+
+// Look name up in the index of the PATH directories: returns 1 and sets
+// *full_path (malloc'd, NULL if no PATH directory has an executable name),
+// or 0 if the index cannot serve the current PATH and it must be searched
+int path_index_lookup(const char *name, char **full_path);
+
+// Called with present=1 when name appears in the first PATH directory and
+// with present=0 when it is gone from the last one
+typedef void (*path_index_listener)(const char *name, int present);
+
+// Bring the index up to date with PATH and pending inotify events; 0 if
+// the index cannot serve the current PATH
+int path_index_refresh(void);
+
+// Whether the index is built for the current PATH and follows its
+// directories (lookups then need no syscalls)
+int path_index_ready(void);
+
+// Set the listener (NULL to remove it); it is first told about every name
+// already in the index
+void path_index_listen(path_index_listener fn);
+
+// Rebuild the index on the next lookup (PATH changed)
+void path_index_invalidate(void);
+
+// Release the index and its inotify watches
+void path_index_free(void);
+
+#endif // PATH_INDEX_H
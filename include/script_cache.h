@@ -0,0 +1,43 @@
+#ifndef SCRIPT_CACHE_H
+#define SCRIPT_CACHE_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+#include "parser.h"
+
+// Environment variable that disables the cache when set
+#define SCRIPT_CACHE_DISABLE_ENV "WSH_NO_CACHE"
+// Environment variable overriding the cache directory
+#define SCRIPT_CACHE_DIR_ENV "WSH_CACHE_DIR"
+
+/*
+ * A batch script compiled to parsed command lists, one entry per line as
+ * read by fgets. The entries live in one serialized buffer that is either
+ * mapped from the cache file or built by compiling the script.
+ */
+typedef struct CompiledScript {
+  unsigned char *data;   // Serialized script
+  size_t size;
+  int mapped;            // Whether data is mmap'd (otherwise malloc'd)
+  size_t *lines;         // Offset of each line record in data
+  int nlines;
+} CompiledScript;
+
+// Compile the script open on fp (or load it from the cache) for the given
+// alias table digest; -1 if the script cannot be cached, in which case fp
+// is left at the start of the script
+int script_cache_open(const char *path, FILE *fp, unsigned long long alias_digest,
+                      CompiledScript *cs);
+
+// Text of line i (NUL terminated, including its newline)
+const char *script_line_text(const CompiledScript *cs, int i);
+
+// Parsed form of line i; 0 if the line has a syntax error and must be
+// executed from its text so the error is reported
+int script_line_list(const CompiledScript *cs, int i, CommandList *list);
+
+// Release a compiled script
+void script_cache_close(CompiledScript *cs);
+
+#endif // SCRIPT_CACHE_H
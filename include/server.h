@@ -0,0 +1,23 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stddef.h>
+
+// Environment variable overriding the server socket path
+#define SERVER_SOCKET_ENV "WSH_SOCKET"
+
+// Request kinds sent by the client
+#define REQUEST_SCRIPT 1   // Run a batch script (path relative to the client's cwd)
+#define REQUEST_COMMAND 2  // Run a single command line
+
+// Socket path: $WSH_SOCKET, $XDG_RUNTIME_DIR/wsh.sock or /tmp/wsh-<uid>.sock
+int server_socket_path(char *buf, size_t len);
+
+// Serve requests on the socket until killed (wsh --server)
+int server_main(void);
+
+// Send a script (or -c command line) to the server with this process's
+// stdin, stdout and stderr; returns the request's exit status (wsh --client)
+int client_main(int argc, char **argv);
+
+#endif // SERVER_H
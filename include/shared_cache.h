@@ -0,0 +1,49 @@
+#ifndef SHARED_CACHE_H
+#define SHARED_CACHE_H
+
+#include "strbuf.h"
+
+// Environment variable enabling the cache: when set, wsh processes of the
+// same user share the compiled rc file and resolved command paths through
+// one shared memory segment
+#define SHARED_CACHE_ENV "WSH_SHARED_CACHE"
+
+// Map the segment if SHARED_CACHE_ENV is set; 0 if it is mapped
+int shared_cache_attach(void);
+
+// Unmap the segment
+void shared_cache_detach(void);
+
+// Identity of the rc file at path (device, inode, size, modification
+// time); 0 if it cannot be shared
+unsigned long long shared_rc_identity(const char *path);
+
+// If the segment holds the rc file with this identity, append its lines
+// other than alias definitions to commands (each NUL terminated), set
+// *digest to the digest of its alias definitions and return 1
+int shared_rc_match(unsigned long long identity, StrBuf *commands,
+                    unsigned long long *digest);
+
+// Copy the rc line defining alias name to line (if not NULL); 1 if found
+int shared_rc_alias(const char *name, StrBuf *line);
+
+// Append every alias definition as name\0line\0 pairs
+void shared_rc_aliases(StrBuf *pairs);
+
+// Store a compiled rc file: aliases as name\0line\0 pairs, commands as
+// NUL terminated lines, digest of the alias definitions
+void shared_rc_publish(unsigned long long identity, const StrBuf *aliases,
+                       const StrBuf *commands, unsigned long long digest);
+
+// Path of an executable another process resolved under the same PATH
+// (malloc'd), or NULL
+char *shared_path_lookup(const char *name);
+
+// Record where name was found
+void shared_path_publish(const char *name, const char *path);
+
+// PATH or one of its directories changed: work out its identity again
+// before the next publish
+void shared_path_invalidate(void);
+
+#endif // SHARED_CACHE_H
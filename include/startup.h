@@ -0,0 +1,19 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <stdio.h>
+
+// Maximum number of startup phases that can be recorded
+#define STARTUP_MAX_PHASES 16
+
+// Enable phase timing (wsh --startup-profile) and start the clock
+void startup_profile_begin(void);
+
+// Record the time since the previous mark as the phase `name`
+// (no-op unless profiling is enabled)
+void startup_phase(const char *name);
+
+// Print the recorded phases and their total once, then stop profiling
+void startup_report(FILE *out);
+
+#endif // STARTUP_H
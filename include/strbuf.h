@@ -0,0 +1,48 @@
+#ifndef STRBUF_H
+#define STRBUF_H
+
+#include <stddef.h>
+
+// Growable string that knows its length; the capacity doubles as it
+// fills, so building a string from any number of pieces costs time linear
+// in its final length. data is NUL terminated whenever it is not NULL.
+typedef struct {
+  char *data;
+  size_t len;
+  size_t capacity;
+} StrBuf;
+
+// An empty StrBuf (nothing allocated until the first write)
+#define STRBUF_INIT {NULL, 0, 0}
+
+// Make room for extra more bytes and the terminator
+void sb_reserve(StrBuf *sb, size_t extra);
+
+// Append n bytes of s
+void sb_append(StrBuf *sb, const char *s, size_t n);
+
+// Append the string s
+void sb_appends(StrBuf *sb, const char *s);
+
+// Append formatted text (printf style)
+void sb_printf(StrBuf *sb, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+// Replace the n bytes at offset at with the slen bytes of s, in place
+void sb_splice(StrBuf *sb, size_t at, size_t n, const char *s, size_t slen);
+
+// Replace the contents with the n bytes of s
+void sb_set(StrBuf *sb, const char *s, size_t n);
+
+// Shorten the string to len bytes
+void sb_truncate(StrBuf *sb, size_t len);
+
+// Write the whole string to fd; -1 (errno set) if a write fails
+int sb_write(const StrBuf *sb, int fd);
+
+// Hand over the string (never NULL; caller frees) and leave sb empty
+char *sb_release(StrBuf *sb);
+
+// Free the string and leave sb empty
+void sb_free(StrBuf *sb);
+
+#endif // STRBUF_H
@@ -0,0 +1,103 @@
+#ifndef TOKENIZER_H
+#define TOKENIZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Byte classification for the tokenizer. Each mask holds one bit per input
+ * byte (bit i of word i / 64 describes line[i]); bits past the end of the
+ * line are zero.
+ */
+typedef struct {
+  size_t len;       // Number of classified bytes
+  size_t nwords;    // Number of 64-bit words in each mask
+  uint64_t *space;  // ' '
+  uint64_t *quote;  // '\''
+  uint64_t *op;     // Operator characters: | & ; < >
+  uint64_t *dollar; // '$'
+} ByteClasses;
+
+// Number of mask words needed to classify len bytes
+#define TOK_MASK_WORDS(len) (((len) + 63) / 64)
+
+// Number of masks in ByteClasses
+#define TOK_NMASKS 4
+
+// Lines up to this many bytes are classified into a lexer's own storage
+#define TOK_STACK_BYTES 2048
+
+typedef enum {
+  TOK_WORD,
+  TOK_PIPE,              // |
+  TOK_OR_IF,             // ||
+  TOK_AMP,               // &
+  TOK_AND_IF,            // &&
+  TOK_SEMI,              // ;
+  TOK_REDIR_IN,          // <
+  TOK_REDIR_OUT,         // >
+  TOK_REDIR_APPEND,      // >>
+  TOK_REDIR_ERR,         // 2>
+  TOK_REDIR_ERR_APPEND,  // 2>>
+  TOK_END                // End of the line
+} TokType;
+
+// Token produced by lex_next; words exclude their surrounding quotes
+typedef struct {
+  TokType type;
+  size_t start;
+  size_t len;
+  int expand;        // Unquoted word containing $ (needs parameter expansion)
+} LexToken;
+
+// Single-pass lexer state: the line is classified once by lex_init
+typedef struct {
+  const char *line;
+  size_t len;
+  size_t pos;        // Start of the next token
+  int operators;     // Whether operator characters form tokens
+  ByteClasses bc;
+  uint64_t *heap_masks;
+  uint64_t stack_masks[TOK_NMASKS * TOK_MASK_WORDS(TOK_STACK_BYTES)];
+} Lexer;
+
+// Span of a token in the line it was split from
+typedef struct {
+  size_t start;
+  size_t len;
+  int expand;  // As in LexToken
+} TokSpan;
+
+// tok_split error codes
+#define TOK_ERR_QUOTE -1     // Missing closing quote
+#define TOK_ERR_OVERFLOW -2  // More than max_spans tokens
+#define TOK_ERR_PAREN -3     // $( without its closing parenthesis
+
+// Classify len bytes of line into the masks of bc (storage provided by caller)
+void tok_classify(const char *line, size_t len, ByteClasses *bc);
+
+// Prepare a lexer over line; operators enables | & ; < > tokens
+void lex_init(Lexer *lx, const char *line, size_t len, int operators);
+
+// Next token of the line (TOK_END at the end); 0, TOK_ERR_QUOTE or
+// TOK_ERR_PAREN
+int lex_next(Lexer *lx, LexToken *tok);
+
+// Index of the parenthesis closing the one at line[open] (single-quoted
+// text is skipped), or len if it is not closed
+size_t tok_match_paren(const char *line, size_t len, size_t open);
+
+// Release a lexer's storage
+void lex_free(Lexer *lx);
+
+// Split line into words (no operators); returns the count or a TOK_ERR_* code
+int tok_split(const char *line, size_t len, TokSpan *spans, int max_spans);
+
+// Force a classifier ("scalar", "sse2", "avx2", NULL for automatic);
+// -1 if unavailable here
+int tok_select(const char *name);
+
+// Name of the classifier in use
+const char *tok_impl_name(void);
+
+#endif // TOKENIZER_H
@@ -0,0 +1,43 @@
+#ifndef TRIE_H
+#define TRIE_H
+
+#include <stddef.h>
+
+// Node of a compressed prefix trie: each edge holds a whole run of bytes
+typedef struct TrieNode {
+  char *label;                  // Bytes on the edge from the parent
+  size_t len;
+  unsigned refs;                // Times the key ending here was inserted (0: not a key)
+  size_t keys;                  // Keys in this subtree
+  struct TrieNode **children;   // Sorted by the first byte of their label
+  int nchildren;
+  int capacity;
+} TrieNode;
+
+// Compressed prefix trie of strings, each key counted by how many times
+// it was inserted so several sources can share a key
+typedef struct {
+  TrieNode root;
+} Trie;
+
+// Create an empty Trie
+Trie *trie_create(void);
+
+// Insert key (or count one more insertion of it)
+void trie_insert(Trie *t, const char *key);
+
+// Undo one insertion of key; it is removed when none remain
+void trie_remove(Trie *t, const char *key);
+
+// Number of distinct keys
+size_t trie_size(const Trie *t);
+
+// Number of keys starting with prefix; sets *common to their longest common
+// prefix (malloc'd, NULL if none) and stores up to max of them, in byte
+// order, in keys (malloc'd strings)
+size_t trie_complete(const Trie *t, const char *prefix, char **common, char **keys, size_t max);
+
+// Free whole Trie
+void trie_free(Trie *t);
+
+#endif // TRIE_H
@@ -1,6 +1,8 @@
 #ifndef WSH_H
 #define WSH_H
 
+#include <setjmp.h>
+
 /**************************************************
  * Constants
  *************************************************/
@@ -8,21 +10,32 @@
 #define MAX_ARGS 128  /* max args on a command line */
 
 #define PROMPT "wsh> " /* prompt */
-#define INVALID_WSH_USE "Invalid usage of wsh. Correct format: wsh | wsh batch_file\n"
+#define RC_FILE ".wshrc" /* startup file in HOME */
+#define RC_FILE_ENV "WSH_RC" /* overrides the startup file path */
+#define INVALID_WSH_USE "Invalid usage of wsh. Correct format: wsh [--startup-profile] [[-j jobs [-k]] batch_file | --server] | wsh --client (batch_file | -c command)\n"
 
 #define CMD_NOT_FOUND "Command not found or not an executable: %s\n"
 #define EMPTY_PIPE_SEGMENT "Empty command segment in pipeline\n"
 #define EMPTY_PATH "PATH empty or not set\n"
 #define MISSING_CLOSING_QUOTE "Missing Closing Quote\n"
+#define TOO_MANY_ARGS "Too many arguments on command line (max %d)\n"
+#define UNSUPPORTED_OPERATOR "Unsupported operator: %.*s\n"
+#define MISSING_REDIRECT_TARGET "Missing file name for redirection\n"
+#define MISSING_COMMAND "Missing command for redirection\n"
+#define EMPTY_LIST_COMMAND "Missing command next to %.*s\n"
 #define UNMATCHED_PAREN "Unmatched parentheses in command substitution\n"
 
 #define INVALID_PATH_USE "Incorrect usage of path. Correct format: path dir1:dir2:...:dirN\n"
 #define INVALID_EXIT_USE "Incorrect usage of exit. Too many arguments\n"
-#define INVALID_ALIAS_USE "Incorrect usage of alias. Correct format: alias | alias name = 'command'\n"
+#define INVALID_ALIAS_USE "Incorrect usage of alias. Correct format: alias | alias -p prefix | alias name = 'command'\n"
 #define INVALID_UNALIAS_USE "Incorrect usage of unalias. Correct format: unalias name\n"
 #define INVALID_WHICH_USE "Incorrect usage of which. Correct format: which name\n"
 #define INVALID_CD_USE "Incorrect usage of cd. Correct format: cd | cd directory\n"
 #define INVALID_HISTORY_USE "Incorrect usage of history. Correct format: history | history n\n"
+#define INVALID_EXPORT_USE "Incorrect usage of export. Correct format: export name=value ...\n"
+#define INVALID_UNSET_USE "Incorrect usage of unset. Correct format: unset name ...\n"
+#define INVALID_ENV_USE "Incorrect usage of env. Correct format: env\n"
+#define INVALID_STATS_USE "Incorrect usage of stats. Correct format: stats\n"
 
 #define WHICH_ALIAS "%s: aliased to '%s'\n"
 #define WHICH_BUILTIN "%s: wsh builtin\n"
@@ -31,6 +44,11 @@
 
 #define CD_NO_HOME "cd: HOME not set\n"
 
+#define SERVER_ALREADY_RUNNING "A wsh server is already listening on %s\n"
+#define SERVER_UNAVAILABLE "Cannot reach wsh server at %s: %s\n"
+#define SOCKET_PATH_TOO_LONG "wsh server socket path too long\n"
+#define REQUEST_TOO_LONG "Script path or command too long\n"
+
 #define HISTORY_INVALID_ARG "Invalid argument passed to history\n"
 
 /**************************************************
@@ -39,10 +57,18 @@
 void interactive_main(void); /* Print prompt and wait for user input */
 int batch_main(const char *script_file); /* Read a commands from script_file line by line */
 
+/**************************************************
+ * Startup
+ *************************************************/
+void rc_load(void); /* Run ~/.wshrc, deferring alias definitions */
+void resolve_all_aliases(void); /* Run all deferred alias definitions */
+char *lookup_alias(const char *name); /* Alias value (NULL if none) */
+unsigned long long alias_digest(void); /* Digest of defined and deferred aliases */
+
 /**************************************************
  * Parsing
  *************************************************/
-void parseline_no_subst(const char *cmdline, char **argv, int *argc);
+void parseline_no_subst(const char *cmdline, char **argv, unsigned char *expand, int *argc);
 
 
 /**************************************************
@@ -51,9 +77,12 @@ void parseline_no_subst(const char *cmdline, char **argv, int *argc);
 void wsh_free(void); /* Free global allocated memory */
 void clean_exit(int return_code); /* Free allocated memory and exit */
 void wsh_warn(const char *msg, ...); /* Set the return code and print message to stderr */
+void batch_free(void); /* Close the running batch file */
 
 // Forward declarations
 
+typedef int (*builtin_fn)(int argc, char **argv);
+
 int wsh_exit(int argc, char **argv);
 int wsh_alias(int argc, char **argv);
 int wsh_unalias(int argc, char **argv);
@@ -61,13 +90,34 @@ int wsh_which(int argc, char **argv);
 int wsh_path(int argc, char **argv);
 int wsh_cd(int argc, char **argv);
 int wsh_history(int argc, char **argv);
-
-int execute_pipeline(char **segments, int num_segments);
-int execute_external_command(int argc, char **argv);
+int wsh_export(int argc, char **argv);
+int wsh_unset(int argc, char **argv);
+int wsh_env(int argc, char **argv);
+#ifdef WSH_PROF
+int wsh_stats(int argc, char **argv);
+#endif
+
+struct SimpleCommand;
+struct Pipeline;
+struct CommandList;
+struct CompiledScript;
+
+builtin_fn find_builtin(const char *name);
+int apply_redirects(const struct SimpleCommand *cmd);
+int run_builtin(builtin_fn func, struct SimpleCommand *cmd);
+int execute_pipeline(struct Pipeline *pl);
+int execute_external_command(struct SimpleCommand *cmd);
 int execute_command(const char *cmdline);
+void add_history(const char *cmdline);
+int execute_list(struct CommandList *list);
+int execute_script_line(const struct CompiledScript *cs, int i);
+int expand_alias(struct SimpleCommand *cmd);
 char *find_executable_path(const char *command_name);
-void execute_segment(const char *segment_cmdline, int in_fd, int out_fd);
+void execute_segment(struct SimpleCommand *cmd, int in_fd, int out_fd);
 
 void free_argv(char **argv, int argc);
 
+extern int rc; /* Status of the last command */
+extern jmp_buf *exit_jmp; /* Where exit jumps to instead of exiting (server mode) */
+
 #endif //WSH_H
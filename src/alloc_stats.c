@@ -0,0 +1,300 @@
+#include "../include/alloc_stats.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Real allocator entry points, resolved by the linker's --wrap option */
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t nmemb, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+void __wrap_free(void *ptr);
+char *__wrap_strdup(const char *s);
+char *__wrap_strndup(const char *s, size_t n);
+
+static const char *subsys_names[ALLOC_NUM_SUBSYS] = {
+    "other", "parser", "history", "alias", "path"};
+
+static AllocStats stats[ALLOC_NUM_SUBSYS];
+static size_t total_live, total_peak;
+static _Thread_local AllocSubsys current_subsys = ALLOC_OTHER;
+
+/* Taken around every counter and live table update: the parallel batch
+   reader thread allocates while the shell does */
+static int stats_lock;
+
+static void lock_stats(void)
+{
+  while (__atomic_test_and_set(&stats_lock, __ATOMIC_ACQUIRE))
+    ;
+}
+
+static void unlock_stats(void)
+{
+  __atomic_clear(&stats_lock, __ATOMIC_RELEASE);
+}
+
+/* A child forked while the reader thread held the lock would spin on it
+   forever: the forking thread holds it across fork instead, so both sides
+   start with it free. Registered before main, so the prepare handler runs
+   after those registered later, which may still allocate. */
+__attribute__((constructor)) static void hold_lock_across_fork(void)
+{
+  pthread_atfork(lock_stats, unlock_stats, unlock_stats);
+}
+
+#ifdef WSH_PROF
+/*
+ * Live blocks, so frees can be charged to the subsystem that allocated
+ * them. Open addressing with linear probing keyed by pointer; the table
+ * itself is allocated with the real allocator so it is never counted.
+ */
+typedef struct {
+  void *ptr;
+  size_t size;
+  AllocSubsys subsys;
+} LiveBlock;
+
+static LiveBlock *live_table;
+static size_t live_capacity, live_count;
+
+static size_t slot_of(const void *ptr)
+{
+  uint64_t h = (uintptr_t)ptr;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return h & (live_capacity - 1);
+}
+
+static void live_insert(void *ptr, size_t size, AllocSubsys subsys);
+
+static void live_grow(void)
+{
+  LiveBlock *old = live_table;
+  size_t old_capacity = live_capacity;
+
+  live_capacity = old_capacity ? old_capacity * 2 : 1024;
+  live_table = __real_calloc(live_capacity, sizeof(LiveBlock));
+  if (!live_table)
+    abort();
+  live_count = 0;
+  for (size_t i = 0; i < old_capacity; i++)
+    if (old[i].ptr)
+      live_insert(old[i].ptr, old[i].size, old[i].subsys);
+  __real_free(old);
+}
+
+static void live_insert(void *ptr, size_t size, AllocSubsys subsys)
+{
+  if ((live_count + 1) * 2 > live_capacity)
+    live_grow();
+  size_t i = slot_of(ptr);
+  while (live_table[i].ptr)
+    i = (i + 1) & (live_capacity - 1);
+  live_table[i] = (LiveBlock){ptr, size, subsys};
+  live_count++;
+}
+
+/* Remove ptr from the table; returns 0 if it was not allocated by us */
+static int live_remove(void *ptr, LiveBlock *out)
+{
+  if (!live_table)
+    return 0;
+  size_t i = slot_of(ptr);
+  while (live_table[i].ptr != ptr)
+  {
+    if (!live_table[i].ptr)
+      return 0;
+    i = (i + 1) & (live_capacity - 1);
+  }
+  *out = live_table[i];
+  live_count--;
+
+  /* Backward-shift deletion keeps probe sequences intact without tombstones */
+  size_t hole = i;
+  for (size_t j = (i + 1) & (live_capacity - 1); live_table[j].ptr; j = (j + 1) & (live_capacity - 1))
+  {
+    size_t home = slot_of(live_table[j].ptr);
+    if ((j > hole && (home <= hole || home > j)) || (j < hole && home <= hole && home > j))
+    {
+      live_table[hole] = live_table[j];
+      hole = j;
+    }
+  }
+  live_table[hole].ptr = NULL;
+  return 1;
+}
+#endif // WSH_PROF
+
+/* Count a successful allocation of `size` bytes (stats locked) */
+static void *count_alloc(void *ptr, size_t size)
+{
+  if (ptr)
+  {
+    AllocStats *s = &stats[current_subsys];
+    s->allocs++;
+    s->bytes += size;
+#ifdef WSH_PROF
+    live_insert(ptr, size, current_subsys);
+    s->live += size;
+    if (s->live > s->peak)
+      s->peak = s->live;
+    total_live += size;
+    if (total_live > total_peak)
+      total_peak = total_live;
+#endif
+  }
+  return ptr;
+}
+
+/* Count the release of a block, charging it to the subsystem that owns it
+   (stats locked) */
+static void count_free(void *ptr)
+{
+  AllocSubsys owner = current_subsys;
+#ifdef WSH_PROF
+  LiveBlock block;
+  if (live_remove(ptr, &block))
+  {
+    owner = block.subsys;
+    stats[owner].live -= block.size;
+    total_live -= block.size;
+  }
+#else
+  (void)ptr;
+#endif
+  stats[owner].frees++;
+}
+
+void *__wrap_malloc(size_t size)
+{
+  void *ptr = __real_malloc(size);
+  lock_stats();
+  count_alloc(ptr, size);
+  unlock_stats();
+  return ptr;
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+  void *ptr = __real_calloc(nmemb, size);
+  lock_stats();
+  count_alloc(ptr, nmemb * size);
+  unlock_stats();
+  return ptr;
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  // Locked throughout: once the old block is released another thread may
+  // be given its address, which must not be in the live table by then
+  lock_stats();
+  void *new_ptr = __real_realloc(ptr, size);
+  if (new_ptr && ptr)
+    count_free(ptr);
+  count_alloc(new_ptr, size);
+  unlock_stats();
+  return new_ptr;
+}
+
+void __wrap_free(void *ptr)
+{
+  if (ptr)
+  {
+    lock_stats();
+    count_free(ptr);
+    unlock_stats();
+  }
+  __real_free(ptr);
+}
+
+/* strdup and strndup allocate inside libc, so they bypass the malloc
+   wrapper unless they are wrapped themselves */
+char *__wrap_strdup(const char *s)
+{
+  size_t len = strlen(s) + 1;
+  char *copy = __wrap_malloc(len);
+  if (copy)
+    memcpy(copy, s, len);
+  return copy;
+}
+
+char *__wrap_strndup(const char *s, size_t n)
+{
+  size_t len = strnlen(s, n);
+  char *copy = __wrap_malloc(len + 1);
+  if (copy)
+  {
+    memcpy(copy, s, len);
+    copy[len] = '\0';
+  }
+  return copy;
+}
+
+/* Snapshot of the counters of all subsystems since start (or the last reset) */
+AllocStats alloc_stats_get(void)
+{
+  AllocStats total = {0};
+  for (int i = 0; i < ALLOC_NUM_SUBSYS; i++)
+  {
+    total.allocs += stats[i].allocs;
+    total.frees += stats[i].frees;
+    total.bytes += stats[i].bytes;
+  }
+  total.live = total_live;
+  total.peak = total_peak;
+  return total;
+}
+
+/* Snapshot of the counters of a single subsystem */
+AllocStats alloc_stats_subsys(AllocSubsys subsys)
+{
+  return stats[subsys];
+}
+
+/* Reset all counters to zero (live bytes stay, they are still allocated) */
+void alloc_stats_reset(void)
+{
+  for (int i = 0; i < ALLOC_NUM_SUBSYS; i++)
+  {
+    size_t live = stats[i].live;
+    memset(&stats[i], 0, sizeof(stats[i]));
+    stats[i].live = stats[i].peak = live;
+  }
+  total_peak = total_live;
+}
+
+/* Print a per-subsystem table of the counters */
+void alloc_stats_report(FILE *out)
+{
+  fprintf(out, "%-10s %10s %10s %12s %10s %10s\n", "subsystem", "allocs", "frees", "bytes", "live", "peak");
+  for (int i = 0; i < ALLOC_NUM_SUBSYS; i++)
+  {
+    const AllocStats *s = &stats[i];
+    fprintf(out, "%-10s %10zu %10zu %12zu %10zu %10zu\n", subsys_names[i],
+            s->allocs, s->frees, s->bytes, s->live, s->peak);
+  }
+  AllocStats total = alloc_stats_get();
+  fprintf(out, "%-10s %10zu %10zu %12zu %10zu %10zu\n", "total",
+          total.allocs, total.frees, total.bytes, total.live, total.peak);
+}
+
+/* Make `subsys` the owner of new allocations; returns the previous owner */
+AllocSubsys alloc_subsys_enter(AllocSubsys subsys)
+{
+  AllocSubsys prev = current_subsys;
+  current_subsys = subsys;
+  return prev;
+}
+
+/* Restore the owner saved by alloc_subsys_enter */
+void alloc_subsys_leave(AllocSubsys *prev)
+{
+  current_subsys = *prev;
+}
@@ -0,0 +1,221 @@
+#define _GNU_SOURCE // pipe2, splice, memfd_create
+
+#include "../include/capture.h"
+#include "../include/event_loop.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/*
+ * Output of a command captured by the shell. The command writes into a
+ * pipe the shell owns, and the event loop reads it as it arrives, so the
+ * command never blocks on a full pipe while the shell waits for other
+ * commands. The first CAPTURE_MEM_BYTES are kept in memory, which covers
+ * almost every command; anything past that is moved into an anonymous
+ * memfd with splice, without passing through the shell, so a command with
+ * a lot of output costs no more memory than one with little. Once the
+ * command is done, capture_write hands the memory and the mapped memfd of
+ * several commands to writev at once.
+ */
+
+// Most bytes read into memory at once
+#define CAPTURE_READ_BYTES 4096
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/* The pipe is at end of file (or failed): stop watching it */
+static void capture_eof(Capture *c)
+{
+  ev_cancel(c->watch);
+  c->watch = -1;
+  close(c->fd);
+  c->fd = -1;
+}
+
+/**
+ * Moves what the pipe holds into the memfd, creating it the first time
+ *
+ * @return Bytes moved, 0 at end of file, or -1 (errno set)
+ */
+static ssize_t spill(Capture *c)
+{
+  if (c->spill_fd == -1 && (c->spill_fd = memfd_create("wsh-capture", MFD_CLOEXEC)) == -1)
+    return -1;
+
+  loff_t off = c->spilled;
+  ssize_t n = splice(c->fd, NULL, c->spill_fd, &off, CAPTURE_SPILL_CHUNK, 0);
+  if (n == -1 && errno == EINVAL)
+  {
+    // No splice into this file: copy through the shell
+    char buf[CAPTURE_READ_BYTES * 4];
+    n = read(c->fd, buf, sizeof(buf));
+    if (n > 0 && pwrite(c->spill_fd, buf, n, c->spilled) != n)
+      return -1;
+  }
+  if (n > 0)
+    c->spilled += n;
+  return n;
+}
+
+/* Read what the pipe holds: into memory until it has CAPTURE_MEM_BYTES,
+   into the memfd after that */
+static void read_capture(int fd, unsigned events, void *data)
+{
+  (void)events;
+  Capture *c = data;
+  ssize_t n;
+  if (c->mem.len < CAPTURE_MEM_BYTES)
+  {
+    size_t want = CAPTURE_MEM_BYTES - c->mem.len;
+    sb_reserve(&c->mem, want < CAPTURE_READ_BYTES ? want : CAPTURE_READ_BYTES);
+    size_t room = c->mem.capacity - c->mem.len - 1;
+    n = read(fd, c->mem.data + c->mem.len, room < want ? room : want);
+    if (n > 0)
+      c->mem.len += n;
+  }
+  else
+  {
+    n = spill(c);
+  }
+
+  if (n == 0 || (n == -1 && errno != EINTR && errno != EAGAIN))
+  {
+    if (n == -1)
+      perror("capture");
+    capture_eof(c);
+  }
+}
+
+/**
+ * @Brief Start capturing the output of a command
+ *
+ * @param c The capture to fill
+ * @return The write end of the pipe (close-on-exec), or -1 (errno set)
+ */
+int capture_open(Capture *c)
+{
+  *c = (Capture){.fd = -1, .watch = -1, .mem = STRBUF_INIT, .spill_fd = -1};
+  int fds[2];
+  if (pipe2(fds, O_CLOEXEC) == -1)
+    return -1;
+  c->fd = fds[0];
+  if ((c->watch = ev_watch_fd(c->fd, EV_READ, read_capture, c)) == -1)
+  {
+    // Nothing would read the pipe while the shell waits
+    close(fds[0]);
+    close(fds[1]);
+    c->fd = -1;
+    errno = ENOMEM;
+    return -1;
+  }
+  return fds[1];
+}
+
+int capture_done(const Capture *c)
+{
+  return c->fd == -1;
+}
+
+int capture_empty(const Capture *c)
+{
+  return c->mem.len == 0 && c->spilled == 0;
+}
+
+/* Write iov[0..n) to fd, going on after short writes */
+static int write_all(int fd, struct iovec *iov, int n)
+{
+  while (n > 0)
+  {
+    ssize_t w = writev(fd, iov, n);
+    if (w == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    while (n > 0 && (size_t)w >= iov->iov_len)
+    {
+      w -= iov->iov_len;
+      iov++;
+      n--;
+    }
+    if (n > 0)
+    {
+      iov->iov_base = (char *)iov->iov_base + w;
+      iov->iov_len -= w;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @Brief Write the output of several commands, in order
+ *
+ * The memory of each capture and its memfd, mapped, become the iovecs of
+ * one writev, so the output of every command finished since the last
+ * write goes out in one call rather than one per command.
+ *
+ * @param fd Where to write
+ * @param caps The captures, in the order to write them
+ * @param n How many there are
+ * @return 0, or -1 (errno set) if a write or a mapping fails
+ */
+int capture_write(int fd, Capture *const *caps, int n)
+{
+  struct iovec iov[IOV_MAX];
+  int niov = 0;
+  for (int i = 0; i < n; i++)
+  {
+    Capture *c = caps[i];
+    if (c->spilled > 0 && !c->map)
+    {
+      c->map = mmap(NULL, c->spilled, PROT_READ, MAP_SHARED, c->spill_fd, 0);
+      if (c->map == MAP_FAILED)
+      {
+        c->map = NULL;
+        return -1;
+      }
+    }
+
+    struct iovec parts[2] = {{c->mem.data, c->mem.len}, {c->map, c->spilled}};
+    for (int p = 0; p < 2; p++)
+    {
+      if (parts[p].iov_len == 0)
+        continue;
+      if (niov == IOV_MAX)
+      {
+        if (write_all(fd, iov, niov) == -1)
+          return -1;
+        niov = 0;
+      }
+      iov[niov++] = parts[p];
+    }
+  }
+  return write_all(fd, iov, niov);
+}
+
+/**
+ * @Brief Stop capturing and release the buffers
+ *
+ * @param c The capture, left closed and empty
+ */
+void capture_free(Capture *c)
+{
+  if (c->fd != -1)
+    capture_eof(c);
+  if (c->map)
+    munmap(c->map, c->spilled);
+  if (c->spill_fd != -1)
+    close(c->spill_fd);
+  sb_free(&c->mem);
+  *c = (Capture){.fd = -1, .watch = -1, .mem = STRBUF_INIT, .spill_fd = -1};
+}
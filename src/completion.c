@@ -0,0 +1,254 @@
+#include "../include/completion.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "../include/path_index.h"
+#include "../include/strbuf.h"
+#include "../include/trie.h"
+
+extern void clean_exit(int return_code);
+
+/*
+ * Command names live in one trie, kept current as they change: the shell
+ * adds builtins and aliases, and the PATH index reports executables as
+ * inotify events reach it. File names are read from the directory when
+ * Tab is pressed, into a trie that lives for that completion only.
+ */
+static Trie *commands = NULL;
+
+// Bytes that end a word on the command line
+#define WORD_BREAKS " \t|;&<>"
+
+static void on_path_name(const char *name, int present)
+{
+  if (present)
+    trie_insert(commands, name);
+  else
+    trie_remove(commands, name);
+}
+
+static char *completion_strdup(const char *s)
+{
+  char *copy = strdup(s);
+  if (!copy)
+  {
+    perror("strdup");
+    clean_exit(EXIT_FAILURE);
+  }
+  return copy;
+}
+
+/**
+ * @Brief Start tracking command names
+ */
+void completion_init(void)
+{
+  if (commands)
+    return;
+  commands = trie_create();
+  path_index_refresh();
+  path_index_listen(on_path_name);
+}
+
+/**
+ * @Brief Add one source of a command name (a builtin or an alias)
+ *
+ * @param name The command name
+ */
+void completion_add_command(const char *name)
+{
+  if (commands)
+    trie_insert(commands, name);
+}
+
+/**
+ * @Brief Remove one source of a command name
+ *
+ * @param name The command name
+ */
+void completion_remove_command(const char *name)
+{
+  if (commands)
+    trie_remove(commands, name);
+}
+
+/**
+ * @Brief Stop tracking command names
+ */
+void completion_free(void)
+{
+  if (!commands)
+    return;
+  path_index_listen(NULL);
+  trie_free(commands);
+  commands = NULL;
+}
+
+/**
+ * @Brief Fill c from the keys of trie starting with word
+ *
+ * @param suffix Appended to the insertion when there is a single match
+ * @return The single match (malloc'd) or NULL
+ */
+static char *complete_from(const Trie *trie, const char *word, const char *suffix, Completion *c)
+{
+  char *keys[COMPLETION_LIST_MAX];
+  char *common;
+  size_t n = trie_complete(trie, word, &common, keys, COMPLETION_LIST_MAX);
+  size_t listed = n < COMPLETION_LIST_MAX ? n : COMPLETION_LIST_MAX;
+  size_t word_len = strlen(word);
+  char *single = NULL;
+
+  c->total = n;
+  if (n == 0)
+    return NULL;
+
+  if (n == 1)
+  {
+    c->insert = malloc(strlen(common) - word_len + strlen(suffix) + 1);
+    if (!c->insert)
+    {
+      perror("malloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    sprintf(c->insert, "%s%s", common + word_len, suffix);
+    single = common;
+    common = NULL;
+  }
+  else if (strlen(common) > word_len)
+  {
+    c->insert = completion_strdup(common + word_len);
+  }
+  else
+  {
+    c->matches = malloc(listed * sizeof(char *));
+    if (!c->matches)
+    {
+      perror("malloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    memcpy(c->matches, keys, listed * sizeof(char *));
+    c->nmatches = listed;
+    listed = 0;
+  }
+  for (size_t i = 0; i < listed; i++)
+    free(keys[i]);
+  free(common);
+  return single;
+}
+
+/**
+ * @Brief Complete a file name relative to its directory part
+ */
+static void complete_file(const char *word, Completion *c)
+{
+  const char *slash = strrchr(word, '/');
+  const char *base = slash ? slash + 1 : word;
+  char *dir = slash ? strndup(word, slash - word + 1) : completion_strdup("./");
+  if (!dir)
+  {
+    perror("strndup");
+    clean_exit(EXIT_FAILURE);
+  }
+
+  DIR *dp = opendir(dir);
+  if (!dp)
+  {
+    free(dir);
+    return;
+  }
+  Trie *files = trie_create();
+  size_t base_len = strlen(base);
+  struct dirent *d;
+  while ((d = readdir(dp)) != NULL)
+  {
+    // Hidden files only when asked for
+    if (d->d_name[0] == '.' && base[0] != '.')
+      continue;
+    if (strcmp(d->d_name, ".") == 0 || strcmp(d->d_name, "..") == 0)
+      continue;
+    if (strncmp(d->d_name, base, base_len) == 0)
+      trie_insert(files, d->d_name);
+  }
+  closedir(dp);
+
+  char *single = complete_from(files, base, "", c);
+  if (single)
+  {
+    // A directory is followed by /, anything else by a space
+    struct stat st;
+    StrBuf text = STRBUF_INIT;
+    sb_appends(&text, dir);
+    sb_appends(&text, single);
+    int is_dir = stat(text.data, &st) == 0 && S_ISDIR(st.st_mode);
+
+    sb_set(&text, c->insert, strlen(c->insert));
+    sb_append(&text, is_dir ? "/" : " ", 1);
+    free(c->insert);
+    c->insert = sb_release(&text);
+    free(single);
+  }
+  trie_free(files);
+  free(dir);
+}
+
+/**
+ * @Brief Complete the word ending at the cursor
+ *
+ * @param line The command line
+ * @param cursor Offset of the cursor in line
+ * @param c Receives the completion (free with completion_result_free)
+ */
+void complete_line(const char *line, size_t cursor, Completion *c)
+{
+  memset(c, 0, sizeof(Completion));
+
+  size_t start = cursor;
+  while (start > 0 && !strchr(WORD_BREAKS, line[start - 1]))
+    start--;
+
+  // A command is expected at the start of the line and after an operator
+  size_t before = start;
+  while (before > 0 && (line[before - 1] == ' ' || line[before - 1] == '\t'))
+    before--;
+  int command_position = before == 0 || strchr("|;&", line[before - 1]) != NULL;
+
+  char *word = strndup(line + start, cursor - start);
+  if (!word)
+  {
+    perror("strndup");
+    clean_exit(EXIT_FAILURE);
+  }
+
+  if (command_position && commands && !strchr(word, '/'))
+  {
+    path_index_refresh();
+    free(complete_from(commands, word, " ", c));
+  }
+  else
+  {
+    complete_file(word, c);
+  }
+  free(word);
+
+  if (!c->insert)
+    c->insert = completion_strdup("");
+}
+
+/**
+ * @Brief Free a completion result
+ *
+ * @param c The completion
+ */
+void completion_result_free(Completion *c)
+{
+  free(c->insert);
+  for (size_t i = 0; i < c->nmatches; i++)
+    free(c->matches[i]);
+  free(c->matches);
+  memset(c, 0, sizeof(Completion));
+}
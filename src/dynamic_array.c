@@ -1,4 +1,5 @@
 #include "../include/dynamic_array.h"
+#include "../include/strbuf.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -127,20 +128,25 @@ void da_delete(DynamicArray *da, const size_t ind)
 
 /**
  * @Brief Print Elements line after line
+ * The elements are gathered into one buffer and written at once.
  *
  * @param da The DynamicArray
  */
 void da_print(DynamicArray *da)
 {
+    StrBuf out = STRBUF_INIT;
+
     /*
     ignore the history command itself when we type 'history',
     so iterate only till 2nd last entry.
     */ 
-    for (size_t i = 0; i < da->size-1; i++) {
-        fprintf(stdout, "%s", da->data[i]);
+    for (size_t i = 0; i + 1 < da->size; i++) {
+        sb_appends(&out, da->data[i]);
     }
+
     fflush(stdout);
-       
+    sb_write(&out, STDOUT_FILENO);
+    sb_free(&out);
 }
 
 /**
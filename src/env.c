@@ -0,0 +1,160 @@
+#include "../include/env.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../include/hash_map.h"
+
+extern void clean_exit(int return_code);
+
+static HashMap *env_hm = NULL;
+static unsigned long version;       // Bumped by every change
+static char **envp_cache = NULL;    // One block: pointers, then NAME=VALUE strings
+static unsigned long envp_version;  // Version envp_cache was built for
+static pid_t shell_pid;             // Recorded by env_init, kept across forks
+
+/**
+ * @Brief Take over the variables of the process environment
+ *
+ * @param envp NULL terminated NAME=VALUE array
+ */
+void env_init(char **envp)
+{
+  env_free();
+  shell_pid = getpid();
+  env_hm = hm_create();
+  for (char **e = envp; e && *e; e++)
+  {
+    const char *eq = strchr(*e, '=');
+    if (!eq || eq == *e)
+      continue;
+    char *name = strndup(*e, eq - *e);
+    if (!name)
+    {
+      perror("strndup");
+      clean_exit(EXIT_FAILURE);
+    }
+    hm_put(env_hm, name, eq + 1);
+    free(name);
+  }
+  version++;
+}
+
+/**
+ * @Brief Process ID of the shell ($$)
+ *
+ * Children forked to run a pipeline stage, a substitution or a parallel
+ * job inherit it, so $$ names the shell wherever it is expanded.
+ *
+ * @return The pid recorded by env_init (the caller's before env_init)
+ */
+pid_t env_shell_pid(void)
+{
+  return shell_pid ? shell_pid : getpid();
+}
+
+/**
+ * @Brief Value of a variable
+ *
+ * @param name The variable name
+ * @return The value (NULL if unset)
+ */
+const char *env_get(const char *name)
+{
+  if (!env_hm)
+    return getenv(name);
+  return hm_get(env_hm, name);
+}
+
+/**
+ * @Brief Set a variable
+ *
+ * @param name The variable name
+ * @param value The new value
+ */
+void env_set(const char *name, const char *value)
+{
+  hm_put(env_hm, name, value);
+  version++;
+}
+
+/**
+ * @Brief Remove a variable
+ *
+ * @param name The variable name
+ */
+void env_unset(const char *name)
+{
+  if (!hm_get(env_hm, name))
+    return;
+  hm_delete(env_hm, name);
+  version++;
+}
+
+/**
+ * @Brief Number of changes made so far
+ */
+unsigned long env_version(void)
+{
+  return version;
+}
+
+/**
+ * @Brief The environment as a NULL terminated NAME=VALUE array
+ *
+ * @return The array, rebuilt only if a variable changed since the last call
+ */
+char **env_envp(void)
+{
+  if (envp_cache && envp_version == version)
+    return envp_cache;
+
+  size_t count = 0, bytes = 0;
+  for (int i = 0; i < TABLE_SIZE; i++)
+  {
+    for (Entry *e = env_hm->buckets[i]; e; e = e->next)
+    {
+      count++;
+      bytes += strlen(e->key) + strlen(e->value) + 2;
+    }
+  }
+
+  char **envp = malloc((count + 1) * sizeof(char *) + bytes);
+  if (!envp)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  char *p = (char *)(envp + count + 1);
+  size_t n = 0;
+  for (int i = 0; i < TABLE_SIZE; i++)
+  {
+    for (Entry *e = env_hm->buckets[i]; e; e = e->next)
+    {
+      envp[n++] = p;
+      p += sprintf(p, "%s=%s", e->key, e->value) + 1;
+    }
+  }
+  envp[n] = NULL;
+
+  free(envp_cache);
+  envp_cache = envp;
+  envp_version = version;
+  return envp;
+}
+
+/**
+ * @Brief Release the environment
+ */
+void env_free(void)
+{
+  if (env_hm)
+  {
+    hm_free(env_hm);
+    env_hm = NULL;
+  }
+  free(envp_cache);
+  envp_cache = NULL;
+}
@@ -0,0 +1,866 @@
+#include "../include/event_loop.h"
+#include "../include/env.h"
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+extern void clean_exit(int return_code);
+
+/*
+ * The shell's event loop. A source is a descriptor to watch, a child to
+ * wait for or a one-shot timer; ev_run_once waits for the first of them
+ * and runs the callback of every source that is ready, so the shell
+ * waiting on a command, the terminal or a pipe still hears from the rest.
+ *
+ * With io_uring, every watched descriptor has a one-shot poll request in
+ * flight, armed again after its callback, and one io_uring_enter both
+ * submits the new requests and waits for completions, with the next
+ * timer's deadline as its timeout. Without it (or with
+ * WSH_EVENT_LOOP=epoll) descriptors stay registered with epoll.
+ *
+ * While children are the only sources, the loop blocks in waitid for any
+ * of them, which costs less than a pidfd per child. Otherwise each child
+ * is watched through its pidfd (opened when first needed) and reaped
+ * with waitpid once that is readable; without pidfds, children are
+ * polled every CHILD_POLL_MS.
+ *
+ * A forked child drops the loop it inherited (the ring is shared with the
+ * parent) and sets up its own the first time it needs one.
+ */
+#define RING_ENTRIES 256     // Submission queue size (completions: twice that)
+#define CHILD_POLL_MS 10     // Polling interval for children without a pidfd
+#define MAX_SOURCES 65536    // Ids keep the slot in their low 16 bits
+#define DISPATCH_BATCH 64    // Completions or epoll events taken at once
+#define TAG_NONE UINT64_MAX  // user_data of requests whose completion is ignored
+
+typedef enum { SRC_FREE, SRC_FD, SRC_CHILD, SRC_TIMER } SourceKind;
+
+typedef struct {
+  SourceKind kind;
+  uint32_t gen;       // Bumped when the slot is freed, so stale events miss it
+  int fd;             // Watched descriptor (a child's pidfd once it has one)
+  unsigned events;
+  int armed;          // io_uring: poll in flight; epoll: registered
+  int always;         // epoll cannot watch fd (a regular file): always ready
+  pid_t pid;          // SRC_CHILD
+  int polled;         // SRC_CHILD without a pidfd: checked every CHILD_POLL_MS
+  uint64_t deadline;  // SRC_TIMER, CLOCK_MONOTONIC nanoseconds
+  union {
+    ev_fd_fn fd;
+    ev_child_fn child;
+    ev_timer_fn timer;
+  } fn;
+  void *data;
+  int next_free;      // Next slot of the free list
+} Source;
+
+typedef struct {
+  int fd;
+  void *ptr;   // Submission and completion rings (one mapping)
+  size_t size;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array, sq_entries;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  struct io_uring_cqe *cqes;
+} Ring;
+
+static enum { BACKEND_NONE, BACKEND_URING, BACKEND_EPOLL } backend;
+static Ring ring = {.fd = -1};
+static int epoll_fd = -1;
+static Source *sources;
+static int nsources, capacity;  // Slots handed out so far, slots allocated
+static int free_list = -1;
+static int active;              // Sources in use
+static int timers;              // Pending timers
+static int children;            // Children being waited for
+static int unwatched_children;  // ...that have no pidfd yet
+static int polled_children;     // ...that cannot have one
+static int always_ready;        // Descriptors epoll refused
+static int pidfd_missing;       // The kernel has no pidfd_open
+
+/***************************************************
+ * Sources
+ ***************************************************/
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static uint64_t source_tag(int i)
+{
+  return (uint64_t)sources[i].gen << 32 | (uint32_t)i;
+}
+
+static int source_id(int i)
+{
+  return (int)((sources[i].gen & 0x7fff) << 16 | (uint32_t)i);
+}
+
+/* Slot of a live source from its id, or -1 */
+static int source_slot(int id)
+{
+  if (id < 0)
+    return -1;
+  int i = id & 0xffff;
+  if (i >= nsources || sources[i].kind == SRC_FREE ||
+      (sources[i].gen & 0x7fff) != (uint32_t)id >> 16)
+    return -1;
+  return i;
+}
+
+static int source_new(SourceKind kind)
+{
+  int i = free_list;
+  if (i != -1)
+  {
+    free_list = sources[i].next_free;
+  }
+  else
+  {
+    if (nsources == MAX_SOURCES)
+    {
+      errno = ENOSPC;
+      return -1;
+    }
+    if (nsources == capacity)
+    {
+      int new_capacity = capacity ? capacity * 2 : 16;
+      Source *grown = realloc(sources, new_capacity * sizeof(Source));
+      if (!grown)
+      {
+        perror("realloc");
+        clean_exit(EXIT_FAILURE);
+      }
+      sources = grown;
+      capacity = new_capacity;
+    }
+    i = nsources++;
+    sources[i].gen = 0;
+  }
+
+  uint32_t gen = sources[i].gen;
+  memset(&sources[i], 0, sizeof(Source));
+  sources[i].kind = kind;
+  sources[i].gen = gen;
+  sources[i].fd = -1;
+  active++;
+  return i;
+}
+
+/***************************************************
+ * io_uring
+ ***************************************************/
+
+static int ring_setup(void)
+{
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  int fd = syscall(SYS_io_uring_setup, RING_ENTRIES, &p);
+  if (fd == -1)
+    return -1;
+
+  // Waiting with a timeout needs EXT_ARG; NODROP keeps completions that
+  // do not fit in the completion queue until there is room
+  unsigned needed = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+  if ((p.features & needed) != needed)
+  {
+    close(fd);
+    return -1;
+  }
+
+  size_t sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  size_t cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  ring.size = sq_size > cq_size ? sq_size : cq_size;
+  ring.ptr = mmap(NULL, ring.size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                  IORING_OFF_SQ_RING);
+  ring.sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  ring.sqes = mmap(NULL, ring.sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   fd, IORING_OFF_SQES);
+  if (ring.ptr == MAP_FAILED || ring.sqes == MAP_FAILED)
+  {
+    if (ring.ptr != MAP_FAILED)
+      munmap(ring.ptr, ring.size);
+    if (ring.sqes != MAP_FAILED)
+      munmap(ring.sqes, ring.sqes_size);
+    close(fd);
+    return -1;
+  }
+
+  char *base = ring.ptr;
+  ring.sq_head = (unsigned *)(base + p.sq_off.head);
+  ring.sq_tail = (unsigned *)(base + p.sq_off.tail);
+  ring.sq_mask = (unsigned *)(base + p.sq_off.ring_mask);
+  ring.sq_array = (unsigned *)(base + p.sq_off.array);
+  ring.sq_entries = p.sq_entries;
+  ring.cq_head = (unsigned *)(base + p.cq_off.head);
+  ring.cq_tail = (unsigned *)(base + p.cq_off.tail);
+  ring.cq_mask = (unsigned *)(base + p.cq_off.ring_mask);
+  ring.cqes = (struct io_uring_cqe *)(base + p.cq_off.cqes);
+  ring.fd = fd;
+  return 0;
+}
+
+static void ring_close(void)
+{
+  munmap(ring.ptr, ring.size);
+  munmap(ring.sqes, ring.sqes_size);
+  close(ring.fd);
+  ring.fd = -1;
+}
+
+/**
+ * Submits the queued requests and, unless timeout_ms is 0, waits up to
+ * timeout_ms (-1: no limit) for a completion
+ *
+ * @return 0, or -1 on error
+ */
+static int ring_enter(int timeout_ms)
+{
+  unsigned to_submit = *ring.sq_tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE);
+  if (to_submit == 0 && timeout_ms == 0)
+    return 0;
+
+  struct __kernel_timespec ts;
+  struct io_uring_getevents_arg arg;
+  memset(&arg, 0, sizeof(arg));
+  unsigned flags = IORING_ENTER_EXT_ARG;
+  if (timeout_ms != 0)
+    flags |= IORING_ENTER_GETEVENTS;
+  if (timeout_ms > 0)
+  {
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (long long)(timeout_ms % 1000) * 1000000;
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+  }
+
+  if (syscall(SYS_io_uring_enter, ring.fd, to_submit, timeout_ms != 0, flags, &arg,
+              sizeof(arg)) == -1)
+  {
+    // Timed out, interrupted, or completions to take before more can wait
+    if (errno == ETIME || errno == EINTR || errno == EBUSY || errno == EAGAIN)
+      return 0;
+    return -1;
+  }
+  return 0;
+}
+
+/* Next free submission entry, submitting the queue first if it is full */
+static struct io_uring_sqe *ring_sqe(void)
+{
+  unsigned tail = *ring.sq_tail;
+  while (tail - __atomic_load_n(ring.sq_head, __ATOMIC_ACQUIRE) == ring.sq_entries)
+  {
+    if (ring_enter(0) == -1)
+      return NULL;
+  }
+
+  unsigned index = tail & *ring.sq_mask;
+  struct io_uring_sqe *sqe = &ring.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  ring.sq_array[index] = index;
+  return sqe;
+}
+
+/* Make the entry from ring_sqe visible to the kernel */
+static void ring_queue(void)
+{
+  __atomic_store_n(ring.sq_tail, *ring.sq_tail + 1, __ATOMIC_RELEASE);
+}
+
+/***************************************************
+ * Arming descriptors
+ ***************************************************/
+
+static int arm(int i)
+{
+  Source *s = &sources[i];
+  if (backend == BACKEND_URING)
+  {
+    struct io_uring_sqe *sqe = ring_sqe();
+    if (!sqe)
+      return -1;
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = s->fd;
+    sqe->poll32_events = s->events;
+    sqe->user_data = source_tag(i);
+    ring_queue();
+  }
+  else
+  {
+    struct epoll_event ev = {.events = s->events, .data.u64 = source_tag(i)};
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, s->fd, &ev) == -1)
+    {
+      if (errno != EPERM)
+        return -1;
+      // Regular files are always ready and epoll refuses them
+      s->always = 1;
+      always_ready++;
+      return 0;
+    }
+  }
+  s->armed = 1;
+  return 0;
+}
+
+static void disarm(int i)
+{
+  Source *s = &sources[i];
+  if (!s->armed)
+    return;
+  s->armed = 0;
+  if (backend == BACKEND_URING)
+  {
+    struct io_uring_sqe *sqe = ring_sqe();
+    if (!sqe)
+      return;
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = source_tag(i);
+    sqe->user_data = TAG_NONE;
+    ring_queue();
+  }
+  else
+  {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, s->fd, NULL);
+  }
+}
+
+/* Stop watching slot i and put it on the free list */
+static void source_release(int i)
+{
+  Source *s = &sources[i];
+  disarm(i);
+  if (s->always)
+    always_ready--;
+  if (s->kind == SRC_TIMER)
+    timers--;
+  if (s->kind == SRC_CHILD)
+  {
+    children--;
+    if (s->polled)
+      polled_children--;
+    else if (s->fd == -1)
+      unwatched_children--;
+    else
+      close(s->fd);
+  }
+  s->kind = SRC_FREE;
+  s->gen++;
+  s->next_free = free_list;
+  free_list = i;
+  active--;
+}
+
+/***************************************************
+ * Setup
+ ***************************************************/
+
+/* Drop the parent's loop in a forked child. The ring is left mapped and
+   open (an exec drops both): unmapping it here costs every command more
+   than the rest of the loop does. */
+static void loop_forked(void)
+{
+  if (backend == BACKEND_URING)
+  {
+    backend = BACKEND_NONE;
+    ring.fd = -1;
+  }
+  ev_free();
+}
+
+/* Set up the loop on first use: 0, or -1 if no backend is available */
+static int loop_init(void)
+{
+  static int failed, atfork_registered;
+  if (backend != BACKEND_NONE)
+    return 0;
+  if (failed)
+    return -1;
+
+  if (!atfork_registered)
+  {
+    pthread_atfork(NULL, NULL, loop_forked);
+    atfork_registered = 1;
+  }
+
+  // The shell's variables, so an export in the rc file or a script counts
+  const char *want = env_get("WSH_EVENT_LOOP");
+  if ((!want || strcmp(want, "epoll") != 0) && ring_setup() == 0)
+  {
+    backend = BACKEND_URING;
+    return 0;
+  }
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd != -1)
+  {
+    backend = BACKEND_EPOLL;
+    return 0;
+  }
+  failed = 1;
+  return -1;
+}
+
+/**
+ * @Brief Name of the mechanism the loop waits with
+ */
+const char *ev_backend(void)
+{
+  loop_init();
+  if (backend == BACKEND_URING)
+    return "io_uring";
+  return backend == BACKEND_EPOLL ? "epoll" : "none";
+}
+
+/**
+ * @Brief Close the loop and drop every source (callbacks are not run)
+ */
+void ev_free(void)
+{
+  for (int i = 0; i < nsources; i++)
+  {
+    if (sources[i].kind == SRC_CHILD && sources[i].fd != -1)
+      close(sources[i].fd);
+  }
+  free(sources);
+  sources = NULL;
+  nsources = capacity = active = 0;
+  free_list = -1;
+  timers = children = unwatched_children = polled_children = always_ready = 0;
+
+  if (backend == BACKEND_URING)
+    ring_close();
+  else if (backend == BACKEND_EPOLL)
+    close(epoll_fd);
+  epoll_fd = -1;
+  backend = BACKEND_NONE;
+}
+
+/***************************************************
+ * Adding and removing sources
+ ***************************************************/
+
+/**
+ * @Brief Watch a descriptor; fn runs from ev_run_once while it is ready
+ *
+ * @param fd The descriptor (stays the caller's; cancel before closing it)
+ * @param events EV_READ and/or EV_WRITE
+ * @return An id for ev_cancel, or -1
+ */
+int ev_watch_fd(int fd, unsigned events, ev_fd_fn fn, void *data)
+{
+  if (loop_init() == -1)
+    return -1;
+  int i = source_new(SRC_FD);
+  if (i == -1)
+    return -1;
+  sources[i].fd = fd;
+  sources[i].events = events;
+  sources[i].fn.fd = fn;
+  sources[i].data = data;
+  if (arm(i) == -1)
+  {
+    source_release(i);
+    return -1;
+  }
+  return source_id(i);
+}
+
+/**
+ * @Brief Reap a child when it exits; fn runs once from ev_run_once
+ *
+ * @param pid A child of the shell that nothing else waits for
+ * @return An id for ev_cancel, or -1
+ */
+int ev_watch_child(pid_t pid, ev_child_fn fn, void *data)
+{
+  if (loop_init() == -1)
+    return -1;
+  int i = source_new(SRC_CHILD);
+  if (i == -1)
+    return -1;
+  sources[i].events = EV_READ;
+  sources[i].pid = pid;
+  sources[i].fn.child = fn;
+  sources[i].data = data;
+  children++;
+  unwatched_children++;
+  return source_id(i);
+}
+
+/**
+ * @Brief Run fn once after ms milliseconds
+ *
+ * @return An id for ev_cancel, or -1
+ */
+int ev_add_timer(int ms, ev_timer_fn fn, void *data)
+{
+  if (loop_init() == -1)
+    return -1;
+  int i = source_new(SRC_TIMER);
+  if (i == -1)
+    return -1;
+  sources[i].deadline = now_ns() + (uint64_t)(ms > 0 ? ms : 0) * 1000000;
+  timers++;
+  sources[i].fn.timer = fn;
+  sources[i].data = data;
+  return source_id(i);
+}
+
+/**
+ * @Brief Remove a source; a child being watched is left for the caller
+ * to reap
+ */
+void ev_cancel(int id)
+{
+  int i = source_slot(id);
+  if (i != -1)
+    source_release(i);
+}
+
+/***************************************************
+ * Running
+ ***************************************************/
+
+/* Give every child without one a pidfd to watch (polled if it cannot) */
+static void watch_children(void)
+{
+  for (int i = 0; unwatched_children > 0 && i < nsources; i++)
+  {
+    Source *s = &sources[i];
+    if (s->kind != SRC_CHILD || s->polled || s->fd != -1)
+      continue;
+    unwatched_children--;
+#ifdef SYS_pidfd_open
+    if (!pidfd_missing)
+    {
+      s->fd = syscall(SYS_pidfd_open, s->pid, 0);
+      if (s->fd == -1 && errno == ENOSYS)
+        pidfd_missing = 1;
+    }
+#else
+    pidfd_missing = 1;
+#endif
+    if (s->fd != -1 && arm(i) == -1)
+    {
+      close(s->fd);
+      s->fd = -1;
+    }
+    if (s->fd == -1)
+    {
+      s->polled = 1;
+      polled_children++;
+    }
+  }
+}
+
+/* Reap the child of slot i if it has exited and run its callback */
+static int reap_child(int i)
+{
+  int status;
+  pid_t r;
+  while ((r = waitpid(sources[i].pid, &status, WNOHANG)) == -1 && errno == EINTR)
+    ;
+  if (r == 0)
+  {
+    // Still running (a polled child, or a spurious wakeup)
+    if (sources[i].fd != -1 && !sources[i].armed && backend == BACKEND_URING)
+      arm(i);
+    return 0;
+  }
+
+  pid_t pid = sources[i].pid;
+  ev_child_fn fn = sources[i].fn.child;
+  void *data = sources[i].data;
+  source_release(i);
+  fn(pid, r == -1 ? -1 : status, data);
+  return 1;
+}
+
+/* Handle one completion or epoll event */
+static int dispatch(uint64_t tag, unsigned revents)
+{
+  if (tag == TAG_NONE)
+    return 0;
+  int i = (int)(uint32_t)tag;
+  if (i >= nsources || sources[i].kind == SRC_FREE || sources[i].gen != tag >> 32)
+    return 0;  // Cancelled after the event was queued
+
+  if (backend == BACKEND_URING)
+    sources[i].armed = 0;
+  if (sources[i].kind == SRC_CHILD)
+    return reap_child(i);
+
+  sources[i].fn.fd(sources[i].fd, revents, sources[i].data);
+  // The callback may have cancelled the watch, and the slot been reused
+  if (backend == BACKEND_URING && sources[i].kind == SRC_FD && sources[i].gen == tag >> 32 &&
+      !sources[i].armed)
+    arm(i);
+  return 1;
+}
+
+static int ring_dispatch(void)
+{
+  struct {
+    uint64_t tag;
+    int32_t res;
+  } done[DISPATCH_BATCH];
+  int ran = 0;
+  for (;;)
+  {
+    // Copy completions out first: callbacks may queue requests or wait
+    unsigned head = *ring.cq_head;
+    unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+    int n = 0;
+    for (; head != tail && n < DISPATCH_BATCH; head++, n++)
+    {
+      const struct io_uring_cqe *cqe = &ring.cqes[head & *ring.cq_mask];
+      done[n].tag = cqe->user_data;
+      done[n].res = cqe->res;
+    }
+    __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+    if (n == 0)
+      return ran;
+
+    for (int k = 0; k < n; k++)
+      ran += dispatch(done[k].tag, done[k].res < 0 ? EV_ERR : (unsigned)done[k].res);
+  }
+}
+
+static int epoll_dispatch(int timeout_ms)
+{
+  struct epoll_event ready[DISPATCH_BATCH];
+  int n = epoll_wait(epoll_fd, ready, DISPATCH_BATCH, timeout_ms);
+  if (n == -1)
+    return errno == EINTR ? 0 : -1;
+
+  int ran = 0;
+  for (int k = 0; k < n; k++)
+    ran += dispatch(ready[k].data.u64, ready[k].events);
+  return ran;
+}
+
+/**
+ * Waits for any child to exit and reaps it if it is one of the sources
+ *
+ * @return 1 after its callback, 0 if interrupted, or -1 if the exited
+ *         child is not a source (the caller waits the general way)
+ */
+static int wait_any_child(void)
+{
+  siginfo_t info;
+  info.si_pid = 0;
+  if (waitid(P_ALL, 0, &info, WEXITED | WNOWAIT) == -1)
+    return errno == EINTR ? 0 : -1;
+  for (int i = 0; i < nsources; i++)
+  {
+    if (sources[i].kind == SRC_CHILD && sources[i].pid == info.si_pid)
+      return reap_child(i);
+  }
+  return -1;
+}
+
+/* Shorter of two timeouts, where -1 means none */
+static int earlier(int a, int b)
+{
+  if (a < 0)
+    return b;
+  if (b < 0)
+    return a;
+  return a < b ? a : b;
+}
+
+/* Run the sources that are ready without a wakeup: expired timers,
+   exited polled children and descriptors epoll refused */
+static int run_unwatched(void)
+{
+  int ran = 0;
+  uint64_t now = now_ns();
+  for (int i = 0; i < nsources; i++)
+  {
+    if (sources[i].kind == SRC_TIMER && sources[i].deadline <= now)
+    {
+      ev_timer_fn fn = sources[i].fn.timer;
+      void *data = sources[i].data;
+      source_release(i);
+      fn(data);
+      ran++;
+    }
+    else if (sources[i].kind == SRC_CHILD && sources[i].polled)
+    {
+      ran += reap_child(i);
+    }
+    else if (sources[i].kind == SRC_FD && sources[i].always)
+    {
+      sources[i].fn.fd(sources[i].fd, sources[i].events, sources[i].data);
+      ran++;
+    }
+  }
+  return ran;
+}
+
+/**
+ * @Brief Wait for sources to be ready and run their callbacks
+ *
+ * @param timeout_ms Longest wait (-1: until something is ready, 0: none)
+ * @return Number of callbacks run (0 on timeout), or -1 on error
+ */
+int ev_run_once(int timeout_ms)
+{
+  if (loop_init() == -1)
+    return -1;
+  if (active == 0 && timeout_ms < 0)
+    return 0;  // Nothing could end the wait
+  if (children == active && timeout_ms < 0)
+  {
+    int ran = wait_any_child();
+    if (ran != -1)
+      return ran;
+  }
+  if (unwatched_children > 0)
+    watch_children();
+
+  int timeout = timeout_ms;
+  uint64_t now = timers > 0 ? now_ns() : 0;
+  for (int i = 0; timers > 0 && i < nsources; i++)
+  {
+    if (sources[i].kind != SRC_TIMER)
+      continue;
+    uint64_t left = sources[i].deadline > now ? sources[i].deadline - now : 0;
+    timeout = earlier(timeout, (int)((left + 999999) / 1000000));
+  }
+  if (polled_children > 0)
+    timeout = earlier(timeout, CHILD_POLL_MS);
+  if (always_ready > 0)
+    timeout = 0;
+
+  int ran;
+  if (backend == BACKEND_URING)
+  {
+    if (ring_enter(timeout) == -1)
+      return -1;
+    ran = ring_dispatch();
+  }
+  else
+  {
+    ran = epoll_dispatch(timeout);
+    if (ran == -1)
+      return -1;
+  }
+  if (timers + polled_children + always_ready > 0)
+    ran += run_unwatched();
+  return ran;
+}
+
+typedef struct {
+  int watch;
+  int ready;
+  int timed_out;
+} ReadWait;
+
+static void read_ready(int fd, unsigned events, void *data)
+{
+  (void)fd;
+  (void)events;
+  ReadWait *w = data;
+  w->ready = 1;
+  ev_cancel(w->watch);  // One wakeup is enough: no need to re-arm
+}
+
+static void read_timeout(void *data)
+{
+  ((ReadWait *)data)->timed_out = 1;
+}
+
+/**
+ * @Brief Run the loop until a descriptor is readable
+ *
+ * @param timeout_ms Longest wait (-1: no limit)
+ * @return 1 if fd is readable (or cannot be watched), 0 on timeout
+ */
+int ev_wait_readable(int fd, int timeout_ms)
+{
+  ReadWait w = {-1, 0, 0};
+  w.watch = ev_watch_fd(fd, EV_READ, read_ready, &w);
+  if (w.watch == -1)
+    return 1;
+  int timer = timeout_ms >= 0 ? ev_add_timer(timeout_ms, read_timeout, &w) : -1;
+
+  while (!w.ready && !w.timed_out)
+  {
+    if (ev_run_once(-1) == -1)
+    {
+      w.ready = 1;  // Let the read report the problem
+      break;
+    }
+  }
+  ev_cancel(w.watch);
+  ev_cancel(timer);
+  return w.ready;
+}
+
+typedef struct {
+  int done;
+  int status;
+} ChildWait;
+
+static void child_exited(pid_t pid, int status, void *data)
+{
+  (void)pid;
+  ChildWait *w = data;
+  w->done = 1;
+  w->status = status;
+}
+
+/**
+ * @Brief Run the loop until a child exits and reap it (a plain waitpid
+ * when no other source is registered)
+ *
+ * @param status Receives the status as from waitpid
+ * @return 0, or -1 (with errno set) if the child could not be waited for
+ */
+int ev_wait_child(pid_t pid, int *status)
+{
+  ChildWait w = {0, 0};
+  // With nothing else to serve, a plain waitpid does
+  int watch = active == 0 ? -1 : ev_watch_child(pid, child_exited, &w);
+  while (watch != -1 && !w.done)
+  {
+    if (ev_run_once(-1) == -1)
+    {
+      ev_cancel(watch);
+      watch = -1;
+    }
+  }
+
+  if (!w.done)
+  {
+    while (waitpid(pid, status, 0) == -1)
+    {
+      if (errno != EINTR)
+        return -1;
+    }
+    return 0;
+  }
+  if (w.status == -1)
+  {
+    errno = ECHILD;
+    return -1;
+  }
+  *status = w.status;
+  return 0;
+}
@@ -0,0 +1,333 @@
+#include "../include/expand.h"
+#include "../include/env.h"
+#include "../include/strbuf.h"
+#include "../include/tokenizer.h"
+#include "../include/event_loop.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Longest variable name looked up without a heap copy
+#define NAME_STACK_BYTES 64
+// Bytes of free space made available for each read of substituted output
+#define SUBST_READ_BYTES 65536
+
+static int is_name_start(char c)
+{
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static int is_name_char(char c)
+{
+  return is_name_start(c) || (c >= '0' && c <= '9');
+}
+
+/* Append the value of the variable named by the n bytes at name */
+static void put_variable(StrBuf *b, const char *name, size_t n)
+{
+  char stack_name[NAME_STACK_BYTES];
+  char *copy = n < sizeof(stack_name) ? stack_name : malloc(n + 1);
+  if (!copy)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  memcpy(copy, name, n);
+  copy[n] = '\0';
+
+  const char *value = env_get(copy);
+  if (value)
+    sb_appends(b, value);
+  if (copy != stack_name)
+    free(copy);
+}
+
+// Output of a command substitution as it is read
+typedef struct {
+  StrBuf *b;
+  int done;  // End of file (or a read error)
+} Output;
+
+/* Read what the pipe holds into the free end of the buffer */
+static void read_output(int fd, unsigned events, void *data)
+{
+  (void)events;
+  Output *out = data;
+  sb_reserve(out->b, SUBST_READ_BYTES);
+  ssize_t n = read(fd, out->b->data + out->b->len, out->b->capacity - out->b->len - 1);
+  if (n > 0)
+    out->b->len += n;
+  else if (n == 0 || errno != EINTR)
+    out->done = 1;
+}
+
+static int is_field_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\0';
+}
+
+/**
+ * @Brief Append the standard output of a command line
+ *
+ * The line is parsed and run by a forked copy of the shell, so no other
+ * shell is started and builtins see the shell's own state. The parent
+ * reads the pipe in large chunks straight into the free end of the output
+ * buffer, which doubles as it fills, so the output is copied once however
+ * large it is. Trailing newlines are removed; when split is set, every run
+ * of blanks and newlines becomes one NUL separating fields.
+ *
+ * @param b The output buffer
+ * @param cmdline The command line (NUL terminated)
+ * @param split Whether to mark field boundaries
+ */
+static void put_command_output(StrBuf *b, const char *cmdline, int split)
+{
+  int fds[2];
+  if (pipe(fds) == -1)
+  {
+    perror("pipe");
+    return;
+  }
+
+  // Anything still buffered would otherwise be written twice
+  fflush(stdout);
+  fflush(stderr);
+  pid_t pid = fork();
+  if (pid == -1)
+  {
+    perror("fork");
+    close(fds[0]);
+    close(fds[1]);
+    return;
+  }
+  if (pid == 0)
+  {
+    close(fds[0]);
+    if (fds[1] != STDOUT_FILENO)
+    {
+      dup2(fds[1], STDOUT_FILENO);
+      close(fds[1]);
+    }
+    // exit ends the substitution, even inside a server request
+    exit_jmp = NULL;
+
+    CommandList list;
+    if (parse_command_list(cmdline, &list) == 0)
+      execute_list(&list);
+    fflush(stdout);
+    _exit(rc);
+  }
+
+  close(fds[1]);
+  size_t start = b->len;
+  // Read through the event loop, so its other sources are served meanwhile
+  Output out = {b, 0};
+  int watch = ev_watch_fd(fds[0], EV_READ, read_output, &out);
+  while (!out.done)
+  {
+    if (watch == -1 || ev_run_once(-1) == -1)
+      read_output(fds[0], EV_READ, &out);
+  }
+  ev_cancel(watch);
+  close(fds[0]);
+  int status;
+  ev_wait_child(pid, &status);
+
+  size_t end = b->len;
+  while (end > start && b->data[end - 1] == '\n')
+    end--;
+  if (split)
+  {
+    size_t out = start;
+    for (size_t i = start; i < end; i++)
+    {
+      if (!is_field_space(b->data[i]))
+        b->data[out++] = b->data[i];
+      else if (out == start || b->data[out - 1] != '\0')
+        b->data[out++] = '\0';
+    }
+    end = out;
+  }
+  sb_truncate(b, end);
+}
+
+/**
+ * @Brief Expand the parameters and command substitutions of a word
+ *
+ * The word is read once from left to right; text between expansions is
+ * copied in runs and each value is appended in place, so the cost is
+ * linear in the length of the word and of the result. A $ that does not
+ * start an expansion is kept as it is.
+ *
+ * @param b The output buffer
+ * @param word The word (quotes already removed)
+ * @param split Whether command output is split into NUL separated fields
+ */
+static void expand_into(StrBuf *b, const char *word, int split)
+{
+  const char *p = word;
+
+  sb_reserve(b, 0);
+  for (;;)
+  {
+    const char *dollar = strchr(p, '$');
+    if (!dollar)
+    {
+      sb_appends(b, p);
+      break;
+    }
+    sb_append(b, p, dollar - p);
+    p = dollar + 1;
+
+    if (*p == '?' || *p == '$')
+    {
+      char num[24];
+      int n = snprintf(num, sizeof(num), "%ld", *p == '?' ? (long)rc : (long)env_shell_pid());
+      sb_append(b, num, n);
+      p++;
+    }
+    else if (*p == '(')
+    {
+      size_t len = strlen(p);
+      size_t close = tok_match_paren(p, len, 0);
+      if (close == len)
+      {
+        // The lexer rejects these; keep the text of words from elsewhere
+        sb_append(b, "$", 1);
+        continue;
+      }
+      char *inner = strndup(p + 1, close - 1);
+      if (!inner)
+      {
+        perror("strndup");
+        clean_exit(EXIT_FAILURE);
+      }
+      put_command_output(b, inner, split);
+      free(inner);
+      p += close + 1;
+    }
+    else if (*p == '{')
+    {
+      const char *name = p + 1;
+      const char *end = name;
+      while (is_name_char(*end))
+        end++;
+      if (*end == '}' && end > name && is_name_start(*name))
+      {
+        put_variable(b, name, end - name);
+        p = end + 1;
+      }
+      else
+      {
+        sb_append(b, "$", 1);
+      }
+    }
+    else if (is_name_start(*p))
+    {
+      const char *end = p;
+      while (is_name_char(*end))
+        end++;
+      put_variable(b, p, end - p);
+      p = end;
+    }
+    else
+    {
+      sb_append(b, "$", 1);
+    }
+  }
+}
+
+/**
+ * @Brief Expand the parameters and command substitutions of a word
+ *
+ * @param word The word (quotes already removed)
+ * @return The expanded word (caller frees)
+ */
+char *expand_word(const char *word)
+{
+  StrBuf b = STRBUF_INIT;
+  expand_into(&b, word, 0);
+  return sb_release(&b);
+}
+
+/* Replace a flagged file name with its expansion */
+static void expand_path(char **path, int flagged)
+{
+  if (!flagged || !*path)
+    return;
+  char *value = expand_word(*path);
+  free(*path);
+  *path = value;
+}
+
+/**
+ * @Brief Expand the flagged arguments and file names of a command
+ *
+ * Only words the lexer saw an unquoted $ in are looked at. The output of
+ * a command substitution is split into separate arguments at blanks and
+ * newlines; an argument that expands to nothing is removed, like an
+ * unquoted empty expansion.
+ *
+ * @param cmd The command, changed in place
+ * @return 0 on success, -1 if the arguments no longer fit
+ */
+int expand_command(SimpleCommand *cmd)
+{
+  char *words[MAX_ARGS];
+  int nwords = 0;
+  int status = 0;
+
+  for (int i = 0; i < cmd->argc; i++)
+  {
+    if (!cmd->expand[i])
+    {
+      if (nwords == MAX_ARGS)
+      {
+        free(cmd->argv[i]);
+        status = -1;
+        continue;
+      }
+      words[nwords++] = cmd->argv[i];
+      continue;
+    }
+
+    StrBuf b = STRBUF_INIT;
+    expand_into(&b, cmd->argv[i], 1);
+    free(cmd->argv[i]);
+    for (size_t f = 0; f < b.len; f += strlen(b.data + f) + 1)
+    {
+      if (b.data[f] == '\0')
+        continue;
+      if (nwords == MAX_ARGS)
+      {
+        status = -1;
+        break;
+      }
+      words[nwords] = strdup(b.data + f);
+      if (!words[nwords])
+      {
+        perror("strdup");
+        clean_exit(EXIT_FAILURE);
+      }
+      nwords++;
+    }
+    sb_free(&b);
+  }
+
+  memcpy(cmd->argv, words, nwords * sizeof(*words));
+  memset(cmd->expand, 0, sizeof(cmd->expand));
+  cmd->argc = nwords;
+  cmd->argv[nwords] = NULL;
+
+  expand_path(&cmd->in_path, cmd->expand_redirs & EXPAND_IN);
+  expand_path(&cmd->out_path, cmd->expand_redirs & EXPAND_OUT);
+  expand_path(&cmd->err_path, cmd->expand_redirs & EXPAND_ERR);
+  cmd->expand_redirs = 0;
+
+  if (status < 0)
+    wsh_warn(TOO_MANY_ARGS, MAX_ARGS);
+  return status;
+}
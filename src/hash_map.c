@@ -1,7 +1,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <unistd.h>
 #include "../include/hash_map.h"
+#include "../include/strbuf.h"
 
 /**
  * @Brief djb2 hash function by Dan Bernstein
@@ -38,9 +40,93 @@ HashMap *hm_create(void)
   {
     ht->buckets[i] = NULL;
   }
+  for (int i = 0; i < HM_INDEX_LEVELS; i++)
+  {
+    ht->index[i] = NULL;
+  }
+  ht->levels = 1;
+  ht->rng = 0x9e3779b97f4a7c15ULL;
   return ht;
 }
 
+/* Level for a new entry: each level above the first with probability 1/4 */
+static int index_random_level(HashMap *hm)
+{
+  // xorshift64
+  hm->rng ^= hm->rng << 13;
+  hm->rng ^= hm->rng >> 7;
+  hm->rng ^= hm->rng << 17;
+
+  unsigned long long bits = hm->rng;
+  int level = 1;
+  while (level < HM_INDEX_LEVELS && (bits & 3) == 0)
+  {
+    level++;
+    bits >>= 2;
+  }
+  return level;
+}
+
+/**
+ * @Brief Find where key belongs in the sorted index
+ *
+ * Fills links[lv], for every level in use, with the link that points at
+ * the first entry on that level whose key is not less than key.
+ *
+ * @param hm Pointer to the HashMap
+ * @param key The key string
+ * @param links Receives one link per level
+ */
+static void index_find(HashMap *hm, const char *key, Entry **links[HM_INDEX_LEVELS])
+{
+  Entry *prev = NULL;  // last entry passed (NULL: still at the heads)
+  for (int lv = hm->levels - 1; lv >= 0; lv--)
+  {
+    Entry **link = prev ? &prev->forward[lv] : &hm->index[lv];
+    while (*link && strcmp((*link)->key, key) < 0)
+    {
+      prev = *link;
+      link = &prev->forward[lv];
+    }
+    links[lv] = link;
+  }
+}
+
+/* Link a new entry into the sorted index */
+static void index_insert(HashMap *hm, Entry *e)
+{
+  Entry **links[HM_INDEX_LEVELS];
+  index_find(hm, e->key, links);
+  for (int lv = hm->levels; lv < e->level; lv++)
+  {
+    links[lv] = &hm->index[lv];
+  }
+  if (e->level > hm->levels)
+  {
+    hm->levels = e->level;
+  }
+  for (int lv = 0; lv < e->level; lv++)
+  {
+    e->forward[lv] = *links[lv];
+    *links[lv] = e;
+  }
+}
+
+/* Unlink an entry from the sorted index */
+static void index_remove(HashMap *hm, Entry *e)
+{
+  Entry **links[HM_INDEX_LEVELS];
+  index_find(hm, e->key, links);
+  for (int lv = 0; lv < e->level; lv++)
+  {
+    *links[lv] = e->forward[lv];
+  }
+  while (hm->levels > 1 && hm->index[hm->levels - 1] == NULL)
+  {
+    hm->levels--;
+  }
+}
+
 /**
  * @Brief Insert or update key-value pair
  *
@@ -67,11 +153,19 @@ void hm_put(HashMap *hm, const char *key, const char *value)
   }
 
   // Insert new entry at head of list
-  Entry *new_entry = malloc(sizeof(Entry));
+  int level = index_random_level(hm);
+  Entry *new_entry = malloc(sizeof(Entry) + level * sizeof(Entry *));
+  if (!new_entry)
+  {
+    perror("malloc");
+    exit(-1);
+  }
   new_entry->key = strdup(key);
   new_entry->value = strdup(value);
+  new_entry->level = level;
   new_entry->next = hm->buckets[idx];
   hm->buckets[idx] = new_entry;
+  index_insert(hm, new_entry);
 }
 
 /**
@@ -114,6 +208,7 @@ void hm_delete(HashMap *hm, const char *key)
       {
         hm->buckets[idx] = e->next;
       }
+      index_remove(hm, e);
       free(e->key);
       free(e->value);
       free(e);
@@ -138,43 +233,90 @@ void hm_print(const HashMap *hm)
   }
 }
 
-/* Print the entries in the hashmap sorted by key */
-int cmp_keys(const void *a, const void *b) {
-  const char *ka = *(const char **)a;
-  const char *kb = *(const char **)b;
-  return strcmp(ka, kb);
+/**
+ * @Brief First entry in key order at or after a key
+ *
+ * @param hm Pointer to the HashMap
+ * @param key The key string
+ * @return The entry, or NULL if every key is less than key
+ */
+Entry *hm_lower_bound(const HashMap *hm, const char *key)
+{
+  const Entry *prev = NULL;
+  Entry *next = NULL;
+  for (int lv = hm->levels - 1; lv >= 0; lv--)
+  {
+    next = prev ? prev->forward[lv] : hm->index[lv];
+    while (next && strcmp(next->key, key) < 0)
+    {
+      prev = next;
+      next = prev->forward[lv];
+    }
+  }
+  return next;
 }
 
-void hm_print_sorted(const HashMap *hm)
+/**
+ * @Brief Print the key-value pairs sorted by key
+ * The index is already in key order, so the listing is a walk from the
+ * first matching key, written at once from one buffer.
+ *
+ * @param hm Pointer to the HashMap
+ * @param prefix Only keys starting with this are printed (NULL: all)
+ */
+void hm_print_sorted(const HashMap *hm, const char *prefix)
 {
-  // Count total entries
-  int count = 0;
-  for (int i = 0; i < TABLE_SIZE; i++) {
-    Entry *e = hm->buckets[i];
-    while (e) {
-      count++;
-      e = e->next;
-    }
+  if (!prefix) prefix = "";
+  size_t prefix_len = strlen(prefix);
+  StrBuf out = STRBUF_INIT;
+
+  for (const Entry *e = hm_lower_bound(hm, prefix);
+       e && strncmp(e->key, prefix, prefix_len) == 0;
+       e = e->forward[0]) {
+    sb_appends(&out, e->key);
+    sb_append(&out, " = '", 4);
+    sb_appends(&out, e->value);
+    sb_append(&out, "'\n", 2);
   }
-  if (count == 0) return;
-  // Collect keys
-  char **keys = malloc(count * sizeof(char *));
-  int idx = 0;
-  for (int i = 0; i < TABLE_SIZE; i++) {
-    Entry *e = hm->buckets[i];
-    while (e) {
-      keys[idx++] = e->key;
-      e = e->next;
-    }
+
+  fflush(stdout);
+  sb_write(&out, STDOUT_FILENO);
+  sb_free(&out);
+}
+
+/* 64-bit FNV-1a of a string, continuing from h */
+static unsigned long long fnv1a(unsigned long long h, const char *s)
+{
+  while (*s)
+  {
+    h ^= (unsigned char)*s++;
+    h *= 0x100000001b3ULL;
   }
-  // Sort keys
-  qsort(keys, count, sizeof(char *), cmp_keys);
-  // Print key-value pairs
-  for (int i = 0; i < count; i++) {
-    char *val = hm_get(hm, keys[i]);
-    printf("%s = '%s'\n", keys[i], val);
+  return h;
+}
+
+/**
+ * @Brief Digest of the key-value pairs, independent of insertion order
+ *
+ * @param hm Pointer to the HashMap
+ * @return A 64-bit value that changes whenever a pair is added, removed or updated
+ */
+unsigned long long hm_digest(const HashMap *hm)
+{
+  unsigned long long digest = 0;
+  for (int i = 0; i < TABLE_SIZE; i++)
+  {
+    for (Entry *e = hm->buckets[i]; e; e = e->next)
+    {
+      unsigned long long h = fnv1a(0xcbf29ce484222325ULL, e->key);
+      h = fnv1a(h ^ 0xff, e->value);
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      digest += h;
+    }
   }
-  free(keys);
+  return digest;
 }
 
 /* Reinitialize the hashmap */
@@ -0,0 +1,205 @@
+#include "../include/job_queue.h"
+
+#include <limits.h>
+#include <linux/futex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+extern void clean_exit(int return_code);
+
+/*
+ * A bounded MPMC ring in the style of Vyukov's, with the producer side
+ * simplified for a single producer. Cell i of lap k is free for the
+ * producer when its seq is i + k * capacity, and holds an item for the
+ * consumers when its seq is one more. The producer fills the cell at tail
+ * and publishes it by storing seq with release order; a consumer claims
+ * the cell at head with a compare-and-swap on head, reads the item and
+ * hands the cell back to the producer's next lap. Neither side ever
+ * blocks the other: a consumer preempted after claiming a cell only holds
+ * up the producer when the ring has wrapped around to that cell.
+ */
+
+static void futex_wait(uint32_t *word, uint32_t expected)
+{
+  syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+}
+
+static void futex_wake_all(uint32_t *word)
+{
+  syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+/* Tell the threads sleeping on ev that something changed (a syscall only
+   when one is) */
+static void event_notify(JobEvent *ev)
+{
+  __atomic_add_fetch(&ev->seq, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&ev->waiters, __ATOMIC_SEQ_CST))
+    futex_wake_all(&ev->seq);
+}
+
+/**
+ * @Brief Create a queue
+ *
+ * @param capacity Largest number of queued items (rounded up to a power of two)
+ * @return The queue (free with jq_free)
+ */
+JobQueue *jq_create(size_t capacity)
+{
+  size_t size = 2;
+  while (size < capacity)
+    size *= 2;
+
+  JobQueue *q = aligned_alloc(64, sizeof(JobQueue));
+  JobCell *cells = malloc(size * sizeof(JobCell));
+  if (!q || !cells)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  for (size_t i = 0; i < size; i++)
+  {
+    cells[i].seq = i;
+    cells[i].item = NULL;
+  }
+  q->cells = cells;
+  q->mask = size - 1;
+  q->tail = 0;
+  q->head = 0;
+  q->pushed = (JobEvent){0, 0};
+  q->popped = (JobEvent){0, 0};
+  q->closed = 0;
+  return q;
+}
+
+/**
+ * @Brief Add an item without waiting (producer only)
+ *
+ * @return 0 on success, -1 if the queue is full
+ */
+int jq_try_push(JobQueue *q, void *item)
+{
+  size_t pos = q->tail;
+  JobCell *cell = &q->cells[pos & q->mask];
+  if (__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) != pos)
+    return -1;
+
+  cell->item = item;
+  __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+  q->tail = pos + 1;
+  event_notify(&q->pushed);
+  return 0;
+}
+
+/**
+ * @Brief Add an item, waiting for a consumer to make room (producer only)
+ *
+ * @return 0 on success, -1 if the queue was closed (item is not queued)
+ */
+int jq_push(JobQueue *q, void *item)
+{
+  for (;;)
+  {
+    if (__atomic_load_n(&q->closed, __ATOMIC_ACQUIRE))
+      return -1;
+    if (jq_try_push(q, item) == 0)
+      return 0;
+
+    // Announce the wait before the last look, so a pop in between wakes us
+    __atomic_add_fetch(&q->popped.waiters, 1, __ATOMIC_SEQ_CST);
+    uint32_t seen = __atomic_load_n(&q->popped.seq, __ATOMIC_SEQ_CST);
+    int pushed = jq_try_push(q, item) == 0;
+    if (!pushed && !__atomic_load_n(&q->closed, __ATOMIC_ACQUIRE))
+      futex_wait(&q->popped.seq, seen);
+    __atomic_sub_fetch(&q->popped.waiters, 1, __ATOMIC_SEQ_CST);
+    if (pushed)
+      return 0;
+  }
+}
+
+/**
+ * @Brief Take the oldest item without waiting
+ *
+ * @return The item, or NULL if the queue is empty
+ */
+void *jq_try_pop(JobQueue *q)
+{
+  size_t pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+  for (;;)
+  {
+    JobCell *cell = &q->cells[pos & q->mask];
+    size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+    ptrdiff_t lag = (ptrdiff_t)(seq - (pos + 1));
+
+    if (lag < 0)
+      return NULL;  // Not filled yet for this lap
+    if (lag > 0)
+    {
+      // Another consumer took it; start again from the current head
+      pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+      continue;
+    }
+    if (__atomic_compare_exchange_n(&q->head, &pos, pos + 1, 1, __ATOMIC_RELAXED,
+                                    __ATOMIC_RELAXED))
+    {
+      void *item = cell->item;
+      __atomic_store_n(&cell->seq, pos + q->mask + 1, __ATOMIC_RELEASE);
+      event_notify(&q->popped);
+      return item;
+    }
+  }
+}
+
+/**
+ * @Brief Take the oldest item, waiting for the producer if there is none
+ *
+ * @return The item, or NULL once the queue is closed and empty
+ */
+void *jq_pop(JobQueue *q)
+{
+  for (;;)
+  {
+    void *item = jq_try_pop(q);
+    if (item)
+      return item;
+
+    __atomic_add_fetch(&q->pushed.waiters, 1, __ATOMIC_SEQ_CST);
+    uint32_t seen = __atomic_load_n(&q->pushed.seq, __ATOMIC_SEQ_CST);
+    item = jq_try_pop(q);
+    int closed = __atomic_load_n(&q->closed, __ATOMIC_ACQUIRE);
+    if (!item && !closed)
+      futex_wait(&q->pushed.seq, seen);
+    __atomic_sub_fetch(&q->pushed.waiters, 1, __ATOMIC_SEQ_CST);
+    if (item)
+      return item;
+    if (closed)
+    {
+      // Every push happened before the close we saw
+      return jq_try_pop(q);
+    }
+  }
+}
+
+/**
+ * @Brief Stop the queue: pushes fail from now on and waiting threads
+ * wake up (consumers still get the items already queued)
+ */
+void jq_close(JobQueue *q)
+{
+  __atomic_store_n(&q->closed, 1, __ATOMIC_RELEASE);
+  event_notify(&q->pushed);
+  event_notify(&q->popped);
+}
+
+/**
+ * @Brief Free a queue
+ */
+void jq_free(JobQueue *q)
+{
+  if (!q)
+    return;
+  free(q->cells);
+  free(q);
+}
@@ -0,0 +1,499 @@
+#include "../include/line_edit.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "../include/completion.h"
+#include "../include/event_loop.h"
+#include "../include/strbuf.h"
+#include "../include/wsh.h"
+
+/*
+ * Raw-mode line editor. The editor remembers what the terminal shows
+ * after the prompt and where its cursor is; a redraw moves to the first
+ * cell that differs from the edited line, rewrites only from there and
+ * puts the cursor back, all in one write. Keys already waiting in the
+ * terminal (a paste, key repeat) are applied before redrawing once.
+ *
+ * Cells are counted as UTF-8 characters, each one column wide; lines
+ * longer than the terminal wrap and are addressed as rows and columns.
+ *
+ * Keys are waited for in the shell's event loop. An escape sequence
+ * arrives all at once, so an ESC not followed by another byte within
+ * ESC_TIMEOUT_MS is a key of its own and does not swallow the next one.
+ */
+#define ESC_TIMEOUT_MS 100
+
+#define KEY_CTRL_A 1
+#define KEY_CTRL_B 2
+#define KEY_CTRL_C 3
+#define KEY_CTRL_D 4
+#define KEY_CTRL_E 5
+#define KEY_CTRL_F 6
+#define KEY_BACKSPACE 8
+#define KEY_TAB 9
+#define KEY_CTRL_K 11
+#define KEY_CTRL_L 12
+#define KEY_CTRL_N 14
+#define KEY_CTRL_P 16
+#define KEY_CTRL_U 21
+#define KEY_CTRL_W 23
+#define KEY_ESC 27
+#define KEY_DEL 127
+
+// Keys decoded from escape sequences (outside the byte range)
+enum {
+  KEY_UP = 256,
+  KEY_DOWN,
+  KEY_RIGHT,
+  KEY_LEFT,
+  KEY_HOME,
+  KEY_END,
+  KEY_DELETE,
+  KEY_UNKNOWN
+};
+
+typedef struct {
+  StrBuf line;             // Line being edited (NUL terminated)
+  size_t pos;              // Cursor offset in line
+  StrBuf shown;            // Line as the terminal shows it
+  size_t cursor_cell;      // Cell of the terminal cursor, counting the prompt
+  StrBuf out;              // Output for the next write
+  const char *prompt;
+  size_t prompt_cells;
+  size_t cols;             // Terminal width
+  const DynamicArray *history;
+  size_t history_pos;      // Entry being edited (history->size: the new line)
+  char *draft;             // New line, kept while browsing history
+} Editor;
+
+static struct termios saved_termios;
+
+/* Read keys one at a time without echo; signal keys arrive as bytes */
+static int raw_mode_enter(void)
+{
+  if (tcgetattr(STDIN_FILENO, &saved_termios) == -1)
+    return -1;
+  struct termios raw = saved_termios;
+  raw.c_iflag &= ~(ICRNL | IXON);
+  raw.c_lflag &= ~(ICANON | ECHO | ISIG | IEXTEN);
+  raw.c_cc[VMIN] = 1;
+  raw.c_cc[VTIME] = 0;
+  return tcsetattr(STDIN_FILENO, TCSADRAIN, &raw);
+}
+
+static void raw_mode_leave(void)
+{
+  tcsetattr(STDIN_FILENO, TCSADRAIN, &saved_termios);
+}
+
+static void out_puts(Editor *e, const char *s)
+{
+  sb_appends(&e->out, s);
+}
+
+static void out_flush(Editor *e)
+{
+  sb_write(&e->out, STDOUT_FILENO);
+  sb_truncate(&e->out, 0);
+}
+
+static int is_continuation(char c)
+{
+  return ((unsigned char)c & 0xc0) == 0x80;
+}
+
+/* Cells taken by the first n bytes of s */
+static size_t cells(const char *s, size_t n)
+{
+  size_t count = 0;
+  for (size_t i = 0; i < n; i++)
+    count += !is_continuation(s[i]);
+  return count;
+}
+
+static size_t prev_char(const Editor *e, size_t pos)
+{
+  if (pos > 0)
+    pos--;
+  while (pos > 0 && is_continuation(e->line.data[pos]))
+    pos--;
+  return pos;
+}
+
+static size_t next_char(const Editor *e, size_t pos)
+{
+  if (pos < e->line.len)
+    pos++;
+  while (pos < e->line.len && is_continuation(e->line.data[pos]))
+    pos++;
+  return pos;
+}
+
+/* Move the terminal cursor to a cell with relative motions */
+static void move_to(Editor *e, size_t cell)
+{
+  char seq[32];
+  size_t from_row = e->cursor_cell / e->cols, to_row = cell / e->cols;
+  size_t from_col = e->cursor_cell % e->cols, to_col = cell % e->cols;
+
+  if (to_row != from_row)
+  {
+    snprintf(seq, sizeof(seq), "\x1b[%zu%c", to_row < from_row ? from_row - to_row : to_row - from_row,
+             to_row < from_row ? 'A' : 'B');
+    out_puts(e, seq);
+  }
+  if (to_col == 0 && from_col != 0)
+  {
+    out_puts(e, "\r");
+  }
+  else if (to_col != from_col)
+  {
+    snprintf(seq, sizeof(seq), "\x1b[%zu%c", to_col < from_col ? from_col - to_col : to_col - from_col,
+             to_col < from_col ? 'D' : 'C');
+    out_puts(e, seq);
+  }
+  e->cursor_cell = cell;
+}
+
+/**
+ * @Brief Bring the terminal in line with the edited line, rewriting only
+ * from the first cell that differs (written by the next out_flush)
+ */
+static void refresh(Editor *e)
+{
+  size_t diff = 0;
+  while (diff < e->line.len && diff < e->shown.len && e->line.data[diff] == e->shown.data[diff])
+    diff++;
+  while (diff > 0 && is_continuation(e->line.data[diff]))
+    diff--;
+
+  if (diff < e->line.len || diff < e->shown.len)
+  {
+    move_to(e, e->prompt_cells + cells(e->line.data, diff));
+    sb_append(&e->out, e->line.data + diff, e->line.len - diff);
+    e->cursor_cell = e->prompt_cells + cells(e->line.data, e->line.len);
+    // Leave the pending wrap state at the right margin
+    if (e->cursor_cell % e->cols == 0 && e->line.len > diff)
+      out_puts(e, "\n");
+    if (cells(e->shown.data, e->shown.len) > cells(e->line.data, e->line.len))
+      out_puts(e, "\x1b[J");
+    sb_set(&e->shown, e->line.data, e->line.len);
+  }
+  move_to(e, e->prompt_cells + cells(e->line.data, e->pos));
+}
+
+/* Print the prompt on a fresh line; the whole line is drawn by refresh */
+static void restart(Editor *e)
+{
+  out_puts(e, e->prompt);
+  sb_truncate(&e->shown, 0);
+  e->cursor_cell = e->prompt_cells;
+}
+
+/* Move to the line after the edited one */
+static void finish_line(Editor *e, const char *text)
+{
+  refresh(e);
+  move_to(e, e->prompt_cells + cells(e->line.data, e->line.len));
+  out_puts(e, text);
+  out_puts(e, "\n");
+}
+
+/* Read one byte, waiting up to timeout_ms (-1: no limit); 0 at end of
+   input or on timeout */
+static int read_byte(unsigned char *ch, int timeout_ms)
+{
+  for (;;)
+  {
+    if (!ev_wait_readable(STDIN_FILENO, timeout_ms))
+      return 0;
+    ssize_t r = read(STDIN_FILENO, ch, 1);
+    if (r == 1)
+      return 1;
+    if (r < 0 && errno == EINTR)
+      continue;
+    return 0;
+  }
+}
+
+/* Decode the rest of an escape sequence */
+static int read_escape(void)
+{
+  unsigned char ch, final = 0;
+  if (!read_byte(&ch, ESC_TIMEOUT_MS) || (ch != '[' && ch != 'O'))
+    return KEY_UNKNOWN;
+
+  int param = 0;
+  while (read_byte(&final, ESC_TIMEOUT_MS) && final >= '0' && final <= ';')
+  {
+    if (final >= '0' && final <= '9')
+      param = param * 10 + (final - '0');
+  }
+  switch (final)
+  {
+  case 'A': return KEY_UP;
+  case 'B': return KEY_DOWN;
+  case 'C': return KEY_RIGHT;
+  case 'D': return KEY_LEFT;
+  case 'H': return KEY_HOME;
+  case 'F': return KEY_END;
+  case '~':
+    if (param == 1 || param == 7)
+      return KEY_HOME;
+    if (param == 4 || param == 8)
+      return KEY_END;
+    if (param == 3)
+      return KEY_DELETE;
+    return KEY_UNKNOWN;
+  default:
+    return KEY_UNKNOWN;
+  }
+}
+
+/* Whether more keys are already waiting (no redraw in between) */
+static int input_pending(void)
+{
+  int n;
+  return ioctl(STDIN_FILENO, FIONREAD, &n) == 0 && n > 0;
+}
+
+/* Replace the line with history entry i (or the draft) */
+static void history_show(Editor *e, size_t i)
+{
+  if (e->history_pos == e->history->size)
+  {
+    free(e->draft);
+    e->draft = strdup(e->line.data);
+    if (!e->draft)
+    {
+      perror("strdup");
+      clean_exit(EXIT_FAILURE);
+    }
+  }
+  e->history_pos = i;
+
+  const char *text = i == e->history->size ? e->draft : e->history->data[i];
+  size_t len = strlen(text);
+  if (len > 0 && text[len - 1] == '\n')
+    len--;
+  sb_set(&e->line, text, len);
+  e->pos = e->line.len;
+}
+
+/* Print candidates in columns below the line */
+static void list_matches(Editor *e, const Completion *c)
+{
+  size_t col_width = 0;
+  for (size_t i = 0; i < c->nmatches; i++)
+  {
+    size_t len = strlen(c->matches[i]);
+    if (len > col_width)
+      col_width = len;
+  }
+  col_width += 2;
+  size_t columns = e->cols / col_width ? e->cols / col_width : 1;
+
+  finish_line(e, "");
+  for (size_t i = 0; i < c->nmatches; i++)
+  {
+    out_puts(e, c->matches[i]);
+    if ((i + 1) % columns == 0 || i + 1 == c->nmatches)
+      out_puts(e, "\n");
+    else
+      for (size_t pad = strlen(c->matches[i]); pad < col_width; pad++)
+        out_puts(e, " ");
+  }
+  if (c->total > c->nmatches)
+  {
+    char more[64];
+    snprintf(more, sizeof(more), "... and %zu more\n", c->total - c->nmatches);
+    out_puts(e, more);
+  }
+  restart(e);
+}
+
+static void complete(Editor *e)
+{
+  Completion c;
+  complete_line(e->line.data, e->pos, &c);
+  size_t n = strlen(c.insert);
+  if (n > 0)
+  {
+    sb_splice(&e->line, e->pos, 0, c.insert, n);
+    e->pos += n;
+  }
+  else if (c.nmatches > 0)
+  {
+    list_matches(e, &c);
+  }
+  else
+  {
+    out_puts(e, "\a");
+  }
+  completion_result_free(&c);
+}
+
+static void editor_free(Editor *e)
+{
+  sb_free(&e->line);
+  sb_free(&e->shown);
+  sb_free(&e->out);
+  free(e->draft);
+}
+
+/**
+ * @Brief Read one line from the terminal with editing, history and tab
+ * completion
+ *
+ * @param prompt The prompt to print
+ * @param history Lines to browse with the up and down keys
+ * @return The line (caller frees, ending in '\n') or NULL at end of input
+ */
+char *line_edit_read(const char *prompt, const DynamicArray *history)
+{
+  Editor e;
+  memset(&e, 0, sizeof(e));
+  e.prompt = prompt;
+  e.prompt_cells = cells(prompt, strlen(prompt));
+  e.history = history;
+  e.history_pos = history->size;
+
+  struct winsize ws;
+  e.cols = ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_col > 0 ? ws.ws_col : 80;
+
+  if (raw_mode_enter() == -1)
+    return NULL;
+  sb_reserve(&e.line, 0);
+  e.line.data[0] = '\0';
+  restart(&e);
+  out_flush(&e);
+
+  for (;;)
+  {
+    unsigned char byte;
+    if (!read_byte(&byte, -1))
+    {
+      raw_mode_leave();
+      editor_free(&e);
+      return NULL;
+    }
+    int key = byte == KEY_ESC ? read_escape() : byte;
+
+    switch (key)
+    {
+    case '\r':
+    case '\n':
+    {
+      finish_line(&e, "");
+      out_flush(&e);
+      raw_mode_leave();
+      sb_append(&e.line, "\n", 1);
+      char *result = sb_release(&e.line);
+      editor_free(&e);
+      return result;
+    }
+    case KEY_CTRL_D:
+      if (e.line.len == 0)
+      {
+        finish_line(&e, "");
+        out_flush(&e);
+        raw_mode_leave();
+        editor_free(&e);
+        return NULL;
+      }
+      // fall through
+    case KEY_DELETE:
+      if (e.pos < e.line.len)
+        sb_splice(&e.line, e.pos, next_char(&e, e.pos) - e.pos, "", 0);
+      break;
+    case KEY_BACKSPACE:
+    case KEY_DEL:
+      if (e.pos > 0)
+      {
+        size_t start = prev_char(&e, e.pos);
+        sb_splice(&e.line, start, e.pos - start, "", 0);
+        e.pos = start;
+      }
+      break;
+    case KEY_CTRL_C:
+      finish_line(&e, "^C");
+      sb_truncate(&e.line, 0);
+      e.pos = 0;
+      e.history_pos = history->size;
+      restart(&e);
+      break;
+    case KEY_CTRL_L:
+      out_puts(&e, "\x1b[H\x1b[2J");
+      restart(&e);
+      break;
+    case KEY_CTRL_U:
+      sb_splice(&e.line, 0, e.pos, "", 0);
+      e.pos = 0;
+      break;
+    case KEY_CTRL_K:
+      sb_splice(&e.line, e.pos, e.line.len - e.pos, "", 0);
+      break;
+    case KEY_CTRL_W:
+    {
+      size_t start = e.pos;
+      while (start > 0 && e.line.data[start - 1] == ' ')
+        start--;
+      while (start > 0 && e.line.data[start - 1] != ' ')
+        start--;
+      sb_splice(&e.line, start, e.pos - start, "", 0);
+      e.pos = start;
+      break;
+    }
+    case KEY_CTRL_A:
+    case KEY_HOME:
+      e.pos = 0;
+      break;
+    case KEY_CTRL_E:
+    case KEY_END:
+      e.pos = e.line.len;
+      break;
+    case KEY_CTRL_B:
+    case KEY_LEFT:
+      e.pos = prev_char(&e, e.pos);
+      break;
+    case KEY_CTRL_F:
+    case KEY_RIGHT:
+      e.pos = next_char(&e, e.pos);
+      break;
+    case KEY_CTRL_P:
+    case KEY_UP:
+      if (e.history_pos > 0)
+        history_show(&e, e.history_pos - 1);
+      break;
+    case KEY_CTRL_N:
+    case KEY_DOWN:
+      if (e.history_pos < history->size)
+        history_show(&e, e.history_pos + 1);
+      break;
+    case KEY_TAB:
+      complete(&e);
+      break;
+    default:
+      // Printable ASCII and the bytes of UTF-8 characters
+      if (key >= ' ' && key < 256)
+      {
+        char ch = (char)key;
+        sb_splice(&e.line, e.pos, 0, &ch, 1);
+        e.pos++;
+      }
+      break;
+    }
+
+    if (!input_pending())
+    {
+      refresh(&e);
+      out_flush(&e);
+    }
+  }
+}
@@ -0,0 +1,707 @@
+#include "../include/parallel.h"
+#include "../include/wsh.h"
+#include "../include/parser.h"
+#include "../include/script_cache.h"
+#include "../include/job_queue.h"
+#include "../include/expand.h"
+#include "../include/env.h"
+#include "../include/startup.h"
+#include "../include/event_loop.h"
+#include "../include/capture.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/*
+ * wsh -j N script: a reader thread turns the script into parsed lines,
+ * decoding them from the script cache or reading and parsing them, and
+ * hands them to the main thread through a JobQueue, so parsing overlaps
+ * with starting and waiting for commands. The main thread starts each
+ * line in a child as soon as one of the N job slots is free, and the
+ * event loop reaps the children as they exit.
+ *
+ * A line that needs the shell itself is a barrier: it waits for every
+ * running job and then runs in the shell as it would in batch_main. That
+ * is a line running a builtin (directly or through an alias), a line whose
+ * command name is only known after expansion, a line reading $? and a
+ * line naming a missing command, whose error is then reported in order.
+ * So builtins see the effects of every line before them, and lines after
+ * them see theirs.
+ *
+ * With -k, the output of every job is captured: the shell points its own
+ * stdout and stderr at two pipes while it starts the job, so the child
+ * inherits them, and the event loop reads them as the job runs. Jobs are
+ * kept in the order of their lines, and whenever the oldest have finished
+ * their output is written with one writev, so the output is that of the
+ * script run line by line without the jobs ever waiting on each other or
+ * on a lock. A barrier line first writes the output of every job before
+ * it. A job may finish up to PARALLEL_CAPTURE_WINDOW times the number of
+ * slots ahead of the oldest running one; past that, the next line waits.
+ */
+
+// What the reader thread reads from and writes to
+typedef struct {
+  FILE *fp;                  // The script, if it is not compiled
+  const CompiledScript *cs;  // Its compiled form (NULL if it could not be cached)
+  JobQueue *queue;
+} Reader;
+
+// A line of the script, parsed by the reader thread
+typedef struct {
+  char *text;        // As read, with its newline
+  CommandList list;
+  int parsed;        // Whether list is owned by the line (0: syntax error)
+} BatchLine;
+
+// A job whose output is captured (wsh -j -k)
+typedef struct {
+  pid_t pid;         // Its child (0 once reaped, or if it did not start)
+  Capture out;
+  Capture err;
+} Job;
+
+static FILE *script_fp = NULL;    // The script (the reader's until it is joined)
+static CompiledScript script;     // Its compiled form, if it could be cached
+static int compiled = 0;
+static JobQueue *queue = NULL;    // Parsed lines, from the reader to the main thread
+static Reader reader_args;
+static pthread_t reader;
+static int reader_running = 0;
+static BatchLine *current = NULL; // Line being run by the main thread
+static pid_t *running = NULL;     // Process of each running job
+static int nrunning = 0;
+static pid_t last_job = 0;        // Job of the latest line, until it is reaped
+static Job *order = NULL;         // Jobs not written yet, oldest first (ring; -k only)
+static int order_size = 0;
+static int order_head = 0;
+static int order_count = 0;
+static Capture **writing = NULL;  // Captures being written together
+static int saved_fds[2] = {-1, -1}; // The shell's stdout and stderr (-k only)
+
+static BatchLine *line_new(const char *text)
+{
+  BatchLine *line = calloc(1, sizeof(BatchLine));
+  if (!line || !(line->text = strdup(text)))
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  return line;
+}
+
+static void line_free(BatchLine *line)
+{
+  if (line->parsed)
+    command_list_free(&line->list);
+  free(line->text);
+  free(line);
+}
+
+/***************************************************
+ * Reader thread
+ ***************************************************/
+
+static void *read_lines(void *arg)
+{
+  const Reader *r = arg;
+  if (r->cs)
+  {
+    for (int i = 0; i < r->cs->nlines; i++)
+    {
+      BatchLine *line = line_new(script_line_text(r->cs, i));
+      line->parsed = script_line_list(r->cs, i, &line->list);
+      if (jq_push(r->queue, line) == -1)
+      {
+        line_free(line);
+        break;
+      }
+    }
+  }
+  else
+  {
+    char cmdline[MAX_LINE];
+    while (fgets(cmdline, sizeof(cmdline), r->fp) != NULL)
+    {
+      // Syntax errors are reported when the line runs, in order
+      BatchLine *line = line_new(cmdline);
+      line->parsed = parse_command_list_quiet(cmdline, &line->list) == 0;
+      if (jq_push(r->queue, line) == -1)
+      {
+        line_free(line);
+        break;
+      }
+    }
+  }
+  jq_close(r->queue);
+  return NULL;
+}
+
+/* Start the reader with every signal blocked, so they reach the main thread */
+static void start_reader(void)
+{
+  sigset_t all, saved;
+  sigfillset(&all);
+  pthread_sigmask(SIG_SETMASK, &all, &saved);
+  reader_args = (Reader){script_fp, compiled ? &script : NULL, queue};
+  int err = pthread_create(&reader, NULL, read_lines, &reader_args);
+  pthread_sigmask(SIG_SETMASK, &saved, NULL);
+  if (err != 0)
+  {
+    errno = err;
+    perror("pthread_create");
+    clean_exit(EXIT_FAILURE);
+  }
+  reader_running = 1;
+}
+
+/***************************************************
+ * Jobs
+ ***************************************************/
+
+/* Whether a word reads $? (only the shell knows the previous status) */
+static int reads_status(const char *word, int expand)
+{
+  return expand && strchr(word, '?') != NULL;
+}
+
+/* Whether the words of an alias value must run in the shell */
+static int alias_needs_shell(const char *value)
+{
+  char *argv[MAX_ARGS + 1];
+  unsigned char expand[MAX_ARGS];
+  int argc;
+  parseline_no_subst(value, argv, expand, &argc);
+
+  int shell = argc == 0 || expand[0] || find_builtin(argv[0]) != NULL;
+  for (int i = 0; i < argc; i++)
+    shell |= reads_status(argv[i], expand[i]);
+  free_argv(argv, argc);
+  return shell;
+}
+
+/* Whether a line must run in the shell rather than in a job */
+static int needs_shell(const CommandList *list)
+{
+  for (int p = 0; p < list->count; p++)
+  {
+    for (int c = 0; c < list->items[p].ncmds; c++)
+    {
+      const SimpleCommand *cmd = &list->items[p].cmds[c];
+      if (cmd->argc == 0 || cmd->expand[0] || find_builtin(cmd->argv[0]))
+        return 1;
+      const char *alias = lookup_alias(cmd->argv[0]);
+      if (alias && alias_needs_shell(alias))
+        return 1;
+      for (int i = 1; i < cmd->argc; i++)
+      {
+        if (reads_status(cmd->argv[i], cmd->expand[i]))
+          return 1;
+      }
+      if ((cmd->in_path && reads_status(cmd->in_path, cmd->expand_redirs & EXPAND_IN)) ||
+          (cmd->out_path && reads_status(cmd->out_path, cmd->expand_redirs & EXPAND_OUT)) ||
+          (cmd->err_path && reads_status(cmd->err_path, cmd->expand_redirs & EXPAND_ERR)))
+        return 1;
+    }
+  }
+  return 0;
+}
+
+/* A job's child exited; the status of the latest line sets rc */
+static void job_exited(pid_t pid, int status, void *data)
+{
+  Job *job = data;
+  if (job)
+    job->pid = 0;
+  for (int i = 0; i < nrunning; i++)
+  {
+    if (running[i] == pid)
+    {
+      running[i] = running[--nrunning];
+      break;
+    }
+  }
+  if (pid == last_job)
+  {
+    rc = WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+    last_job = 0;
+  }
+}
+
+/* Whether a job has been reaped and its output read to the end */
+static int job_finished(const Job *job)
+{
+  return job->pid == 0 && capture_done(&job->out) && capture_done(&job->err);
+}
+
+/* Free the n oldest jobs, whether or not their output was written */
+static void drop_jobs(int n)
+{
+  for (; n > 0; n--, order_count--)
+  {
+    Job *job = &order[order_head];
+    capture_free(&job->out);
+    capture_free(&job->err);
+    order_head = (order_head + 1) % order_size;
+  }
+}
+
+/**
+ * Writes the output of the oldest jobs, up to the first that has not
+ * finished. Their stdout goes out in one capture_write, split only after
+ * a job that wrote to stderr, whose stderr is written right after its
+ * stdout.
+ */
+static void write_finished(void)
+{
+  int n = 0;
+  while (n < order_count && job_finished(&order[(order_head + n) % order_size]))
+    n++;
+  if (n == 0)
+    return;
+
+  // The shell's own output comes before that of the jobs after it
+  fflush(stdout);
+  int pending = 0;
+  for (int i = 0; i < n; i++)
+  {
+    Job *job = &order[(order_head + i) % order_size];
+    if (!capture_empty(&job->out))
+      writing[pending++] = &job->out;
+    if (capture_empty(&job->err) && i < n - 1)
+      continue;
+
+    if (pending > 0 && capture_write(STDOUT_FILENO, writing, pending) == -1)
+      perror("writev");
+    pending = 0;
+    Capture *err = &job->err;
+    if (!capture_empty(err) && capture_write(STDERR_FILENO, &err, 1) == -1)
+      perror("writev");
+  }
+  drop_jobs(n);
+}
+
+/* Run the event loop once, then write the output of the jobs that finished */
+static int run_loop(void)
+{
+  if (ev_run_once(-1) == -1)
+  {
+    perror("ev_run_once");
+    return -1;
+  }
+  if (order)
+    write_finished();
+  return 0;
+}
+
+/* Run the event loop until a job finishes */
+static void reap_job(void)
+{
+  int before = nrunning;
+  while (nrunning == before)
+  {
+    if (run_loop() == -1)
+    {
+      nrunning = 0;
+      drop_jobs(order_count);
+      return;
+    }
+  }
+}
+
+/* Wait for every running job and write the output of each */
+static void reap_all(void)
+{
+  while (nrunning > 0)
+    reap_job();
+  // A job's output may outlast it (a child it left behind holds the pipe)
+  while (order_count > 0 && run_loop() == 0)
+    ;
+  drop_jobs(order_count);
+  last_job = 0;
+}
+
+/* Wait for a free job slot and, with -k, for room in the order */
+static void wait_slot(int jobs)
+{
+  if (nrunning == jobs)
+    reap_job();
+  while (order_count == order_size && order_count > 0)
+  {
+    if (run_loop() == -1)
+      drop_jobs(order_count);
+  }
+}
+
+/**
+ * Looks up every command of a job in the shell, so the PATH index is
+ * read once rather than by every child. A line that is one command has
+ * its alias expanded here too, so it can be spawned directly.
+ *
+ * @param path Receives the executable when the line is one command, which
+ *             the child then executes directly
+ * @param result Receives the result of the line when it was run in the
+ *               shell (as execute_command returns it)
+ * @return 1 if the job can start, 0 if the line was run in the shell
+ *         (failing with a warning), or -1 if it must run in the shell
+ */
+static int resolve_job(CommandList *list, char **path, int *result)
+{
+  *path = NULL;
+  *result = EXIT_FAILURE;
+  if (list->count == 1 && list->items[0].ncmds == 1)
+  {
+    SimpleCommand *cmd = &list->items[0].cmds[0];
+    if (expand_alias(cmd) < 0)
+      return 0;
+    if ((*path = find_executable_path(cmd->argv[0])) != NULL)
+      return 1;
+
+    // Missing: report it in order, as run_pipeline would
+    reap_all();
+    if (expand_command(cmd) == 0)
+      *result = execute_external_command(cmd);
+    return 0;
+  }
+
+  for (int p = 0; p < list->count; p++)
+  {
+    for (int c = 0; c < list->items[p].ncmds; c++)
+    {
+      const char *name = list->items[p].cmds[c].argv[0];
+      if (lookup_alias(name))
+        continue;
+      char *full_path = find_executable_path(name);
+      if (!full_path)
+        return -1;
+      free(full_path);
+    }
+  }
+  return 1;
+}
+
+/* Body of a job's child: run the line as the shell would and exit */
+static void run_job(BatchLine *line, const char *path)
+{
+  // The reader thread and the script stay with the shell
+  reader_running = 0;
+  script_fp = NULL;
+  queue = NULL;
+  current = NULL;
+  exit_jmp = NULL;
+  // So is the output of the other jobs
+  order = NULL;
+  order_count = 0;
+  saved_fds[0] = saved_fds[1] = -1;
+
+  if (path)
+  {
+    SimpleCommand *cmd = &line->list.items[0].cmds[0];
+    if (expand_command(cmd) < 0 || apply_redirects(cmd) == -1)
+      _exit(EXIT_FAILURE);
+    execve(path, cmd->argv, env_envp());
+    wsh_warn(CMD_NOT_FOUND, cmd->argv[0]);
+    _exit(EXIT_FAILURE);
+  }
+
+  line->parsed = 0;
+  execute_list(&line->list);
+  fflush(stdout);
+  _exit(rc);
+}
+
+/**
+ * Starts a single command without redirections with posix_spawn, which
+ * lends the child the shell's memory until it executes the command. A
+ * forked child would share the shell's pages copy-on-write while the shell
+ * goes on to the next line, so every page the shell touched before the
+ * exec would be copied.
+ *
+ * @return The child, or -1 if it could not be started (after a warning)
+ */
+static pid_t spawn_command(SimpleCommand *cmd, const char *path)
+{
+  if (expand_command(cmd) < 0)
+    return -1;
+
+  pid_t pid;
+  int err = posix_spawn(&pid, path, NULL, NULL, cmd->argv, env_envp());
+  if (err != 0)
+  {
+    wsh_warn(CMD_NOT_FOUND, cmd->argv[0]);
+    return -1;
+  }
+  return pid;
+}
+
+/* Open the pipes capturing a job's output; 0 or -1 */
+static int open_captures(Job *job, int fds[2])
+{
+  if ((fds[0] = capture_open(&job->out)) == -1)
+    return -1;
+  if ((fds[1] = capture_open(&job->err)) == -1)
+  {
+    close(fds[0]);
+    capture_free(&job->out);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * With -k, adds a job to the order and points the shell's stdout and
+ * stderr at pipes capturing its output, so its child inherits them and a
+ * warning about starting it is captured with it too. Undone by job_end.
+ *
+ * @return The job, or NULL if its output cannot be captured, in which case
+ *         every job before it has finished and been written
+ */
+static Job *job_begin(void)
+{
+  if (!order)
+    return NULL;
+
+  Job *job = &order[(order_head + order_count) % order_size];
+  int fds[2];
+  if (open_captures(job, fds) == -1)
+  {
+    // Out of descriptors: they come back as the jobs finish
+    reap_all();
+    if (open_captures(job, fds) == -1)
+    {
+      perror("pipe");
+      return NULL;
+    }
+  }
+  dup2(fds[0], STDOUT_FILENO);
+  dup2(fds[1], STDERR_FILENO);
+  close(fds[0]);
+  close(fds[1]);
+  job->pid = 0;
+  order_count++;
+  return job;
+}
+
+/* Point stdout and stderr back at the shell's own, closing the last copy of
+   the job's pipes the shell holds */
+static void job_end(void)
+{
+  dup2(saved_fds[0], STDOUT_FILENO);
+  dup2(saved_fds[1], STDERR_FILENO);
+}
+
+/* Start a line in a child, waiting for a free slot first; EXIT_FAILURE if
+   it could not be started */
+static int start_job(BatchLine *line, const char *path, int jobs)
+{
+  wait_slot(jobs);
+
+  // Children inherit stdio buffers; flush so nothing is written twice
+  fflush(stdout);
+  fflush(stderr);
+  Job *job = job_begin();
+  env_envp();
+  SimpleCommand *cmd = &line->list.items[0].cmds[0];
+  pid_t pid;
+  if (path && !cmd->in_path && !cmd->out_path && !cmd->err_path)
+  {
+    pid = spawn_command(cmd, path);
+  }
+  else if ((pid = fork()) == -1)
+  {
+    perror("fork");
+  }
+  else if (pid == 0)
+  {
+    run_job(line, path);
+  }
+  if (job)
+    job_end();
+  if (pid == -1)
+  {
+    rc = EXIT_FAILURE;
+    return EXIT_FAILURE;
+  }
+
+  if (job)
+    job->pid = pid;
+  running[nrunning++] = pid;
+  last_job = pid;
+  if (ev_watch_child(pid, job_exited, job) == -1)
+  {
+    // Without the loop the job runs alone
+    int status;
+    if (ev_wait_child(pid, &status) == -1)
+      status = -1;
+    job_exited(pid, status, job);
+  }
+  // A job whose output is not captured must finish before the next starts
+  if (order && !job)
+    reap_all();
+  return EXIT_SUCCESS;
+}
+
+/**
+ * Runs one line: in a job if it can be, otherwise in the shell once every
+ * job has finished
+ *
+ * @return What execute_command would return for the line: EXIT_SUCCESS
+ *         once a job is started, whatever its status
+ */
+static int run_line(BatchLine *line, int jobs)
+{
+  if (!line->parsed)
+  {
+    reap_all();
+    return execute_command(line->text);
+  }
+  if (line->list.count == 0)
+    return EXIT_SUCCESS;
+
+  add_history(line->text);
+  if (!needs_shell(&line->list))
+  {
+    char *path;
+    int result;
+    int found = resolve_job(&line->list, &path, &result);
+    if (found == 1)
+      result = start_job(line, path, jobs);
+    free(path);
+    if (found >= 0)
+      return result;
+  }
+
+  reap_all();
+  line->parsed = 0;
+  return execute_list(&line->list);
+}
+
+/**
+ * @Brief Batch mode with up to jobs lines running at once
+ *
+ * @param script_file Path to the script file
+ * @param jobs Number of job slots (1 to PARALLEL_MAX_JOBS)
+ * @param keep_order Whether to capture the output of the jobs and write it
+ *                   in the order of their lines
+ * @return The result of the last line, as batch_main returns it
+ */
+int parallel_batch_main(const char *script_file, int jobs, int keep_order)
+{
+  script_fp = fopen(script_file, "r");
+  if (script_fp == NULL)
+  {
+    perror("fopen");
+    rc = EXIT_FAILURE;
+    return EXIT_FAILURE;
+  }
+
+  compiled = script_cache_open(script_file, script_fp, alias_digest(), &script) == 0;
+  startup_phase("script load");
+  startup_report(stderr);
+
+  running = malloc(jobs * sizeof(pid_t));
+  if (!running)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  if (keep_order)
+  {
+    order_size = jobs * PARALLEL_CAPTURE_WINDOW;
+    order = malloc(order_size * sizeof(Job));
+    writing = malloc(order_size * sizeof(Capture *));
+    if (!order || !writing)
+    {
+      perror("malloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    for (int fd = 0; fd < 2; fd++)
+    {
+      if ((saved_fds[fd] = fcntl(STDOUT_FILENO + fd, F_DUPFD_CLOEXEC, 3)) == -1)
+      {
+        perror("fcntl");
+        clean_exit(EXIT_FAILURE);
+      }
+    }
+  }
+  queue = jq_create(PARALLEL_QUEUE_LINES);
+  start_reader();
+
+  int result = EXIT_SUCCESS;
+  while ((current = jq_pop(queue)) != NULL)
+  {
+    result = run_line(current, jobs);
+    line_free(current);
+    current = NULL;
+  }
+  reap_all();
+
+  parallel_batch_free();
+  return result;
+}
+
+/**
+ * @Brief Stop the reader thread and release the script, the lines still
+ * queued and the output not yet written (a no-op outside parallel batch
+ * mode)
+ */
+void parallel_batch_free(void)
+{
+  if (queue)
+  {
+    jq_close(queue);
+    if (reader_running && !pthread_equal(pthread_self(), reader))
+      pthread_join(reader, NULL);
+    reader_running = 0;
+
+    BatchLine *line;
+    while ((line = jq_try_pop(queue)) != NULL)
+      line_free(line);
+    jq_free(queue);
+    queue = NULL;
+  }
+  if (current)
+  {
+    line_free(current);
+    current = NULL;
+  }
+  if (compiled)
+  {
+    script_cache_close(&script);
+    compiled = 0;
+  }
+  if (script_fp)
+  {
+    fclose(script_fp);
+    script_fp = NULL;
+  }
+  free(running);
+  running = NULL;
+  nrunning = 0;
+  if (order)
+  {
+    drop_jobs(order_count);
+    free(order);
+    order = NULL;
+    free(writing);
+    writing = NULL;
+    order_size = order_head = 0;
+  }
+  for (int fd = 0; fd < 2; fd++)
+  {
+    if (saved_fds[fd] != -1)
+    {
+      // In case the shell exits while a job's pipes stand in for them
+      dup2(saved_fds[fd], STDOUT_FILENO + fd);
+      close(saved_fds[fd]);
+      saved_fds[fd] = -1;
+    }
+  }
+}
@@ -0,0 +1,291 @@
+#include "../include/parser.h"
+#include "../include/tokenizer.h"
+#include "../include/alloc_stats.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Whether syntax errors are reported (cleared by parse_command_list_quiet,
+   which the batch reader thread calls while the shell parses too) */
+static _Thread_local int report_errors = 1;
+
+#define PARSE_ERROR(...)       \
+  do                           \
+  {                            \
+    if (report_errors)         \
+      wsh_warn(__VA_ARGS__);   \
+  } while (0)
+
+/* Append an empty command to the pipeline */
+static SimpleCommand *pipeline_add(Pipeline *pl)
+{
+  if (pl->ncmds == pl->capacity)
+  {
+    int new_capacity = pl->capacity ? pl->capacity * 2 : 4;
+    SimpleCommand *new_cmds = realloc(pl->cmds, new_capacity * sizeof(SimpleCommand));
+    if (!new_cmds)
+    {
+      perror("realloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    pl->cmds = new_cmds;
+    pl->capacity = new_capacity;
+  }
+
+  SimpleCommand *cmd = &pl->cmds[pl->ncmds++];
+  memset(cmd, 0, sizeof(*cmd));
+  return cmd;
+}
+
+/* Copy the text of a token */
+static char *token_dup(const char *line, const LexToken *tok)
+{
+  char *s = strndup(line + tok->start, tok->len);
+  if (!s)
+  {
+    perror("strndup");
+    clean_exit(EXIT_FAILURE);
+  }
+  return s;
+}
+
+/* Append an empty pipeline to the list */
+static Pipeline *list_add(CommandList *list)
+{
+  if (list->count == list->capacity)
+  {
+    int new_capacity = list->capacity ? list->capacity * 2 : 4;
+    Pipeline *new_items = realloc(list->items, new_capacity * sizeof(Pipeline));
+    if (!new_items)
+    {
+      perror("realloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    list->items = new_items;
+    list->capacity = new_capacity;
+  }
+
+  Pipeline *pl = &list->items[list->count++];
+  memset(pl, 0, sizeof(*pl));
+  return pl;
+}
+
+/* Check the last command of a pipeline once an operator or the end is reached */
+static int pipeline_complete(const SimpleCommand *cmd, int saw_pipe)
+{
+  if (saw_pipe && (!cmd || cmd->argc == 0))
+  {
+    PARSE_ERROR(EMPTY_PIPE_SEGMENT);
+    return -1;
+  }
+  if (cmd && cmd->argc == 0)
+  {
+    PARSE_ERROR(MISSING_COMMAND);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Parse a command line into a list of pipelines
+ *
+ * The line is lexed once; words fill the current command, | starts the
+ * next command, ;, && and || start the next pipeline and <, >, >>, 2> and
+ * 2>> take the following word as a file name. A trailing ; is allowed and
+ * an empty line yields a list with no pipelines.
+ *
+ * @param cmdline The command line (a trailing newline is ignored)
+ * @param list Filled with the parsed list (free with command_list_free)
+ * @return 0 on success, -1 on a syntax error (already reported)
+ */
+int parse_command_list(const char *cmdline, CommandList *list)
+{
+  ALLOC_SCOPE(ALLOC_PARSER);
+  memset(list, 0, sizeof(*list));
+
+  size_t len = strlen(cmdline);
+  if (len > 0 && cmdline[len - 1] == '\n')
+    len--;
+
+  Lexer lx;
+  lex_init(&lx, cmdline, len, 1);
+
+  Pipeline *pl = list_add(list);
+  SimpleCommand *cmd = NULL;
+  int saw_pipe = 0;
+  LexToken tok, target;
+  LexToken last_op = {TOK_END, 0, 0, 0};
+
+  for (;;)
+  {
+    int err = lex_next(&lx, &tok);
+    if (err != 0)
+    {
+      PARSE_ERROR(err == TOK_ERR_PAREN ? UNMATCHED_PAREN : MISSING_CLOSING_QUOTE);
+      goto fail;
+    }
+
+    switch (tok.type)
+    {
+    case TOK_WORD:
+      if (!cmd)
+        cmd = pipeline_add(pl);
+      if (cmd->argc == MAX_ARGS)
+      {
+        PARSE_ERROR(TOO_MANY_ARGS, MAX_ARGS);
+        goto fail;
+      }
+      cmd->expand[cmd->argc] = tok.expand;
+      cmd->argv[cmd->argc++] = token_dup(cmdline, &tok);
+      break;
+
+    case TOK_PIPE:
+      if (!cmd || cmd->argc == 0)
+      {
+        PARSE_ERROR(EMPTY_PIPE_SEGMENT);
+        goto fail;
+      }
+      cmd = NULL;
+      saw_pipe = 1;
+      break;
+
+    case TOK_REDIR_IN:
+    case TOK_REDIR_OUT:
+    case TOK_REDIR_APPEND:
+    case TOK_REDIR_ERR:
+    case TOK_REDIR_ERR_APPEND:
+    {
+      err = lex_next(&lx, &target);
+      if (err != 0)
+      {
+        PARSE_ERROR(err == TOK_ERR_PAREN ? UNMATCHED_PAREN : MISSING_CLOSING_QUOTE);
+        goto fail;
+      }
+      if (target.type != TOK_WORD)
+      {
+        PARSE_ERROR(MISSING_REDIRECT_TARGET);
+        goto fail;
+      }
+      if (!cmd)
+        cmd = pipeline_add(pl);
+
+      int to_err = tok.type == TOK_REDIR_ERR || tok.type == TOK_REDIR_ERR_APPEND;
+      char **path = tok.type == TOK_REDIR_IN ? &cmd->in_path
+                  : to_err ? &cmd->err_path
+                  : &cmd->out_path;
+      unsigned char bit = tok.type == TOK_REDIR_IN ? EXPAND_IN
+                        : to_err ? EXPAND_ERR
+                        : EXPAND_OUT;
+      free(*path);
+      *path = token_dup(cmdline, &target);
+      cmd->expand_redirs = (cmd->expand_redirs & ~bit) | (target.expand ? bit : 0);
+      if (tok.type == TOK_REDIR_OUT || tok.type == TOK_REDIR_APPEND)
+        cmd->out_append = tok.type == TOK_REDIR_APPEND;
+      if (to_err)
+        cmd->err_append = tok.type == TOK_REDIR_ERR_APPEND;
+      break;
+    }
+
+    case TOK_SEMI:
+    case TOK_AND_IF:
+    case TOK_OR_IF:
+      if (pipeline_complete(cmd, saw_pipe) != 0)
+        goto fail;
+      if (pl->ncmds == 0)
+      {
+        PARSE_ERROR(EMPTY_LIST_COMMAND, (int)tok.len, cmdline + tok.start);
+        goto fail;
+      }
+      pl->next_op = tok.type == TOK_SEMI ? LIST_SEQ
+                  : tok.type == TOK_AND_IF ? LIST_AND
+                  : LIST_OR;
+      last_op = tok;
+      pl = list_add(list);
+      cmd = NULL;
+      saw_pipe = 0;
+      break;
+
+    case TOK_END:
+      goto end;
+
+    default:
+      PARSE_ERROR(UNSUPPORTED_OPERATOR, (int)tok.len, cmdline + tok.start);
+      goto fail;
+    }
+  }
+
+end:
+  if (pipeline_complete(cmd, saw_pipe) != 0)
+    goto fail;
+  if (pl->ncmds == 0)
+  {
+    /* Nothing after the last operator: fine after ;, an error after && or || */
+    if (last_op.type == TOK_AND_IF || last_op.type == TOK_OR_IF)
+    {
+      PARSE_ERROR(EMPTY_LIST_COMMAND, (int)last_op.len, cmdline + last_op.start);
+      goto fail;
+    }
+    list->count--;
+    if (list->count > 0)
+      list->items[list->count - 1].next_op = LIST_END;
+  }
+
+  lex_free(&lx);
+  return 0;
+
+fail:
+  lex_free(&lx);
+  command_list_free(list);
+  return -1;
+}
+
+/**
+ * @Brief Parse a command line like parse_command_list without printing
+ * syntax errors or touching the return code
+ *
+ * @param cmdline The command line (a trailing newline is ignored)
+ * @param list Filled with the parsed list (free with command_list_free)
+ * @return 0 on success, -1 on a syntax error
+ */
+int parse_command_list_quiet(const char *cmdline, CommandList *list)
+{
+  report_errors = 0;
+  int result = parse_command_list(cmdline, list);
+  report_errors = 1;
+  return result;
+}
+
+/**
+ * @Brief Free everything owned by a pipeline
+ *
+ * @param pl The pipeline (left empty and reusable)
+ */
+void pipeline_free(Pipeline *pl)
+{
+  for (int i = 0; i < pl->ncmds; i++)
+  {
+    SimpleCommand *cmd = &pl->cmds[i];
+    free_argv(cmd->argv, cmd->argc);
+    free(cmd->in_path);
+    free(cmd->out_path);
+    free(cmd->err_path);
+  }
+  free(pl->cmds);
+  memset(pl, 0, sizeof(*pl));
+}
+
+/**
+ * @Brief Free every pipeline of a list
+ *
+ * @param list The list (left empty and reusable)
+ */
+void command_list_free(CommandList *list)
+{
+  for (int i = 0; i < list->count; i++)
+  {
+    pipeline_free(&list->items[i]);
+  }
+  free(list->items);
+  memset(list, 0, sizeof(*list));
+}
@@ -0,0 +1,520 @@
+#include "../include/path_index.h"
+#include "../include/env.h"
+#include "../include/shared_cache.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * In-memory index of the PATH directories: every name found in any of
+ * them maps to a bitmask of the directories (in PATH order) that hold it,
+ * so a lookup takes the lowest directory whose entry is executable.
+ * Executability is checked with access() the first time an entry is the
+ * candidate and then remembered, so repeated lookups make no syscalls.
+ *
+ * Each directory is read with one getdents64 scan and watched with
+ * inotify; the inotify descriptor raises SIGIO, whose handler only sets a
+ * flag, and the queued events are applied to the index on the next lookup.
+ * A listener can follow the names as they come and go (tab completion).
+ *
+ * A relative or unwatchable PATH directory is searched with access() at
+ * its place in PATH on every lookup, since a command could appear there
+ * without an event. A missing one holds nothing; its nearest existing
+ * ancestor is watched instead, and the index is rebuilt when the next
+ * component of its path appears.
+ *
+ * A forked child keeps the index as it was at the fork, but the inotify
+ * descriptor is shared with the parent, so the child closes its copy and
+ * leaves the events to the parent; a name the child does not find is then
+ * searched for.
+ */
+#define WATCH_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB | \
+                      IN_DELETE_SELF | IN_MOVE_SELF)
+
+typedef struct {
+  char *name;           // NULL for an empty slot
+  uint64_t dirs;        // Bit i: PATH directory i has an entry called name
+  uint64_t checked;     // Bit i: that entry has been checked with access()
+  uint64_t executable;  // Bit i: ...and it is executable
+} IndexEntry;
+
+// Directory entry as returned by getdents64
+struct linux_dirent64 {
+  uint64_t d_ino;
+  int64_t d_off;
+  unsigned short d_reclen;
+  unsigned char d_type;
+  char d_name[];
+};
+
+static IndexEntry *table;  // Open addressing with linear probing
+static size_t capacity, count;
+static char *dirs[PATH_INDEX_MAX_DIRS];
+static int wds[PATH_INDEX_MAX_DIRS];
+static char *awaited[PATH_INDEX_MAX_DIRS];  // For a missing directory: the name
+                                            // to appear in the watched ancestor
+static uint64_t searched;  // Bit i: directory i is searched on every lookup
+static int ndirs;
+static char *indexed_path_env;  // PATH the index was built for
+static int enabled;
+static int inotify_fd = -1;
+static volatile sig_atomic_t dirty;
+static int forked;  // The index was inherited and gets no events
+static path_index_listener listener;  // Told when a name comes and goes
+
+static void on_sigio(int sig)
+{
+  (void)sig;
+  dirty = 1;
+}
+
+static uint64_t hash_name(const char *s)
+{
+  uint64_t h = 0xcbf29ce484222325ULL;
+  while (*s)
+  {
+    h ^= (unsigned char)*s++;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+/* Slot holding name, or the empty slot where it would go */
+static size_t find_slot(const char *name)
+{
+  size_t i = hash_name(name) & (capacity - 1);
+  while (table[i].name && strcmp(table[i].name, name) != 0)
+    i = (i + 1) & (capacity - 1);
+  return i;
+}
+
+static void grow_table(void)
+{
+  IndexEntry *old = table;
+  size_t old_capacity = capacity;
+
+  capacity = old_capacity ? old_capacity * 2 : 1024;
+  table = calloc(capacity, sizeof(IndexEntry));
+  if (!table)
+  {
+    perror("calloc");
+    exit(EXIT_FAILURE);
+  }
+  for (size_t i = 0; i < old_capacity; i++)
+  {
+    if (old[i].name)
+      table[find_slot(old[i].name)] = old[i];
+  }
+  free(old);
+}
+
+/* Record that directory i has an entry called name (to be checked again) */
+static void index_add(const char *name, int i)
+{
+  size_t slot = find_slot(name);
+  if (!table[slot].name)
+  {
+    if ((count + 1) * 2 > capacity)
+    {
+      grow_table();
+      slot = find_slot(name);
+    }
+    table[slot].name = strdup(name);
+    if (!table[slot].name)
+    {
+      perror("strdup");
+      exit(EXIT_FAILURE);
+    }
+    count++;
+  }
+  if (!table[slot].dirs && listener)
+    listener(name, 1);
+  table[slot].dirs |= 1ULL << i;
+  table[slot].checked &= ~(1ULL << i);
+}
+
+/* Record that the entry name of directory i went away or changed mode */
+static void index_forget(const char *name, int i, int removed)
+{
+  size_t slot = find_slot(name);
+  if (!table[slot].name)
+    return;
+  if (removed && table[slot].dirs)
+  {
+    table[slot].dirs &= ~(1ULL << i);
+    if (!table[slot].dirs && listener)
+      listener(name, 0);
+  }
+  table[slot].checked &= ~(1ULL << i);
+}
+
+static void clear_index(void)
+{
+  for (size_t i = 0; i < capacity; i++)
+  {
+    if (table[i].name && table[i].dirs && listener)
+      listener(table[i].name, 0);
+    free(table[i].name);
+  }
+  free(table);
+  table = NULL;
+  capacity = count = 0;
+  for (int i = 0; i < ndirs; i++)
+  {
+    free(dirs[i]);
+    free(awaited[i]);
+    awaited[i] = NULL;
+  }
+  ndirs = 0;
+  searched = 0;
+  if (inotify_fd != -1)
+  {
+    close(inotify_fd);
+    inotify_fd = -1;
+  }
+  enabled = 0;
+}
+
+/* Add every non-directory entry of directory i with one getdents64 scan */
+static int scan_dir(int i)
+{
+  int fd = open(dirs[i], O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd == -1)
+    return -1;
+
+  char buf[16384] __attribute__((aligned(8)));
+  for (;;)
+  {
+    long n = syscall(SYS_getdents64, fd, buf, sizeof(buf));
+    if (n < 0)
+    {
+      close(fd);
+      return -1;
+    }
+    if (n == 0)
+      break;
+    for (long off = 0; off < n;)
+    {
+      struct linux_dirent64 *d = (struct linux_dirent64 *)(buf + off);
+      off += d->d_reclen;
+      // Skips . and .. as well
+      if (d->d_type != DT_DIR)
+        index_add(d->d_name, i);
+    }
+  }
+  close(fd);
+  return 0;
+}
+
+/**
+ * Watches the nearest existing ancestor of missing directory i for the
+ * next component of its path to appear
+ *
+ * @return 0, or -1 if no ancestor can be watched
+ */
+static int watch_missing(int i)
+{
+  char path[PATH_MAX];
+  size_t len = strlen(dirs[i]);
+  if (len >= sizeof(path))
+    return -1;
+  memcpy(path, dirs[i], len + 1);
+
+  for (;;)
+  {
+    while (len > 1 && path[len - 1] == '/')
+      path[--len] = '\0';
+    char *slash = strrchr(path, '/');
+    if (!slash || slash[1] == '\0')
+      return -1;
+    // The component after slash stays intact while the ancestor is cut
+    *slash = '\0';
+    wds[i] = inotify_add_watch(inotify_fd, slash == path ? "/" : path, WATCH_EVENTS | IN_ONLYDIR);
+    if (wds[i] != -1)
+      return (awaited[i] = strdup(slash + 1)) ? 0 : -1;
+    if ((errno != ENOENT && errno != ENOTDIR) || slash == path)
+      return -1;
+    len = slash - path;
+  }
+}
+
+static void apply_events(void);
+
+/* Apply the queued events before a fork, so the child starts up to date */
+static void index_prepare_fork(void)
+{
+  if (enabled && dirty && !forked)
+  {
+    dirty = 0;
+    apply_events();
+  }
+}
+
+/* In the child: leave the inotify events to the parent */
+static void index_forked(void)
+{
+  if (inotify_fd != -1)
+  {
+    close(inotify_fd);
+    inotify_fd = -1;
+  }
+  dirty = 0;
+  forked = 1;
+}
+
+/* Watch and scan every directory of path_env; enabled stays 0 on failure */
+static void build_index(const char *path_env)
+{
+  static int handler_installed;
+
+  clear_index();
+  forked = 0;
+  if (!path_env || !*path_env)
+    return;
+
+  if (!handler_installed)
+  {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_sigio;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    if (sigaction(SIGIO, &sa, NULL) != 0)
+      return;
+    pthread_atfork(index_prepare_fork, NULL, index_forked);
+    handler_installed = 1;
+  }
+
+  // Same splitting as the PATH walk in find_executable_path
+  char *copy = strdup(path_env);
+  if (!copy)
+    return;
+  for (char *dir = strtok(copy, ":"); dir; dir = strtok(NULL, ":"))
+  {
+    if (ndirs == PATH_INDEX_MAX_DIRS || !(dirs[ndirs] = strdup(dir)))
+    {
+      free(copy);
+      clear_index();
+      return;
+    }
+    ndirs++;
+  }
+  free(copy);
+
+  inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd == -1 ||
+      fcntl(inotify_fd, F_SETOWN, getpid()) == -1 ||
+      fcntl(inotify_fd, F_SETFL, fcntl(inotify_fd, F_GETFL) | O_ASYNC) == -1)
+  {
+    clear_index();
+    return;
+  }
+
+  grow_table();
+  // Watch before scanning so no change is missed; events for changes the
+  // scan already saw are applied again harmlessly
+  for (int i = 0; i < ndirs; i++)
+  {
+    wds[i] = -1;
+    if (dirs[i][0] == '/')
+    {
+      wds[i] = inotify_add_watch(inotify_fd, dirs[i], WATCH_EVENTS | IN_ONLYDIR);
+      if (wds[i] == -1 && (errno == ENOENT || errno == ENOTDIR) && watch_missing(i) == 0)
+        continue;
+      if (wds[i] != -1 && scan_dir(i) == 0)
+        continue;
+    }
+    // Relative, or it cannot be watched or read
+    wds[i] = -1;
+    searched |= 1ULL << i;
+  }
+  enabled = 1;
+}
+
+/* Apply the queued inotify events to the index */
+static void apply_events(void)
+{
+  char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+  int rebuild = 0;
+  ssize_t n;
+
+  while ((n = read(inotify_fd, buf, sizeof(buf))) > 0)
+  {
+    for (char *p = buf; p < buf + n;)
+    {
+      struct inotify_event *ev = (struct inotify_event *)p;
+      p += sizeof(*ev) + ev->len;
+
+      if (ev->mask & (IN_Q_OVERFLOW | IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+      {
+        rebuild = 1;
+        continue;
+      }
+      if (ev->len == 0)
+        continue;
+
+      // A directory can appear in PATH more than once
+      for (int i = 0; i < ndirs; i++)
+      {
+        if (wds[i] != ev->wd)
+          continue;
+        if (awaited[i])
+        {
+          // The missing directory (or one of its ancestors) may be there now
+          if ((ev->mask & (IN_CREATE | IN_MOVED_TO)) && strcmp(ev->name, awaited[i]) == 0)
+            rebuild = 1;
+        }
+        else if (ev->mask & (IN_CREATE | IN_MOVED_TO))
+        {
+          if (!(ev->mask & IN_ISDIR))
+            index_add(ev->name, i);
+        }
+        else
+        {
+          index_forget(ev->name, i, (ev->mask & (IN_DELETE | IN_MOVED_FROM)) != 0);
+        }
+      }
+    }
+  }
+
+  if (rebuild)
+    build_index(indexed_path_env);
+  // The shared path table was keyed by the directories as they were
+  shared_path_invalidate();
+}
+
+/**
+ * @Brief Bring the index up to date with PATH and the queued inotify events
+ *
+ * @return 1 if the index can serve lookups, 0 otherwise
+ */
+int path_index_refresh(void)
+{
+  const char *path_env = env_get("PATH");
+
+  if (!indexed_path_env || !path_env || strcmp(indexed_path_env, path_env) != 0)
+  {
+    free(indexed_path_env);
+    indexed_path_env = path_env ? strdup(path_env) : NULL;
+    build_index(indexed_path_env);
+  }
+  if (enabled && dirty && !forked)
+  {
+    dirty = 0;
+    apply_events();
+  }
+  return enabled;
+}
+
+/**
+ * @Brief Whether the index is built for the current PATH
+ *
+ * @return 1 if it is and it receives the directories' events, 0 otherwise
+ */
+int path_index_ready(void)
+{
+  return enabled && !forked && indexed_path_env != NULL;
+}
+
+/**
+ * @Brief Set the listener told about names of the index, starting with
+ * the names already present
+ *
+ * @param fn The listener (NULL to remove it)
+ */
+void path_index_listen(path_index_listener fn)
+{
+  listener = fn;
+  if (!fn)
+    return;
+  for (size_t i = 0; i < capacity; i++)
+  {
+    if (table[i].name && table[i].dirs)
+      fn(table[i].name, 1);
+  }
+}
+
+/**
+ * @Brief Look a command up in the PATH directory index
+ *
+ * @param name The command name
+ * @param full_path Set to the full path (caller frees) or NULL if not found
+ * @return 1 if the index answered, 0 if PATH must be searched instead
+ */
+int path_index_lookup(const char *name, char **full_path)
+{
+  if (!path_index_refresh() || strchr(name, '/'))
+    return 0;
+
+  *full_path = NULL;
+  IndexEntry *e = &table[find_slot(name)];
+  for (uint64_t bits = (e->name ? e->dirs : 0) | searched; bits; bits &= bits - 1)
+  {
+    int i = __builtin_ctzll(bits);
+    uint64_t bit = 1ULL << i;
+    char candidate[PATH_MAX];
+    int len = snprintf(candidate, sizeof(candidate), "%s/%s", dirs[i], name);
+    if (len < 0 || (size_t)len >= sizeof(candidate))
+      continue;
+
+    int executable;
+    if (searched & bit)
+    {
+      // Not remembered: the directory sends no events
+      executable = access(candidate, X_OK) == 0;
+    }
+    else
+    {
+      if (!(e->checked & bit))
+      {
+        e->checked |= bit;
+        if (access(candidate, X_OK) == 0)
+          e->executable |= bit;
+        else
+          e->executable &= ~bit;
+      }
+      executable = (e->executable & bit) != 0;
+    }
+    if (executable)
+    {
+      *full_path = strdup(candidate);
+      if (!*full_path)
+      {
+        perror("strdup");
+        exit(EXIT_FAILURE);
+      }
+      return 1;
+    }
+  }
+  // A forked child may have created the command since the fork
+  return !forked;
+}
+
+/**
+ * @Brief Rebuild the index on the next lookup
+ */
+void path_index_invalidate(void)
+{
+  free(indexed_path_env);
+  indexed_path_env = NULL;
+}
+
+/**
+ * @Brief Release the index and its inotify watches
+ */
+void path_index_free(void)
+{
+  path_index_invalidate();
+  clear_index();
+}
@@ -0,0 +1,558 @@
+#include "../include/script_cache.h"
+#include "../include/alloc_stats.h"
+#include "../include/wsh.h"
+#include "../include/env.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * Cache file layout (native byte order):
+ *
+ *   header   "WSHC", u32 version, u64 mtime sec, u64 mtime nsec, u64 size,
+ *            u64 alias digest, str script path
+ *   body     u32 line count, then per line:
+ *            u32 length, text, '\0', u8 kind, and for parsed lines
+ *            u32 pipelines, per pipeline u8 next_op, u32 commands,
+ *            per command u32 argc, argc (str, u8 expand), str <, str >, u8 >>,
+ *            str 2>, u8 expand bits of the file names
+ *
+ * A str is a u32 length followed by its bytes; NO_STRING stands for NULL.
+ * The stored lists are taken before alias substitution and parameter
+ * expansion, since both depend on state that changes as the script runs.
+ */
+#define CACHE_MAGIC "WSHC"
+#define CACHE_VERSION 3
+#define NO_STRING UINT32_MAX
+
+enum
+{
+  LINE_PARSED,
+  LINE_REPARSE
+};
+
+/* Growable buffer a script is serialized into */
+typedef struct
+{
+  unsigned char *data;
+  size_t len;
+  size_t capacity;
+} OutBuf;
+
+/* Bounds-checked reader over a serialized script */
+typedef struct
+{
+  const unsigned char *data;
+  size_t len;
+  size_t pos;
+} InBuf;
+
+static void out_bytes(OutBuf *b, const void *p, size_t n)
+{
+  if (b->len + n > b->capacity)
+  {
+    size_t new_capacity = b->capacity ? b->capacity * 2 : 4096;
+    while (new_capacity < b->len + n)
+      new_capacity *= 2;
+    unsigned char *new_data = realloc(b->data, new_capacity);
+    if (!new_data)
+    {
+      perror("realloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    b->data = new_data;
+    b->capacity = new_capacity;
+  }
+  memcpy(b->data + b->len, p, n);
+  b->len += n;
+}
+
+static void out_u8(OutBuf *b, uint8_t v)
+{
+  out_bytes(b, &v, sizeof(v));
+}
+
+static void out_u32(OutBuf *b, uint32_t v)
+{
+  out_bytes(b, &v, sizeof(v));
+}
+
+static void out_u64(OutBuf *b, uint64_t v)
+{
+  out_bytes(b, &v, sizeof(v));
+}
+
+static void out_str(OutBuf *b, const char *s)
+{
+  if (!s)
+  {
+    out_u32(b, NO_STRING);
+    return;
+  }
+  size_t len = strlen(s);
+  out_u32(b, len);
+  out_bytes(b, s, len);
+}
+
+static void out_list(OutBuf *b, const CommandList *list)
+{
+  out_u32(b, list->count);
+  for (int i = 0; i < list->count; i++)
+  {
+    const Pipeline *pl = &list->items[i];
+    out_u8(b, pl->next_op);
+    out_u32(b, pl->ncmds);
+    for (int j = 0; j < pl->ncmds; j++)
+    {
+      const SimpleCommand *cmd = &pl->cmds[j];
+      out_u32(b, cmd->argc);
+      for (int k = 0; k < cmd->argc; k++)
+      {
+        out_str(b, cmd->argv[k]);
+        out_u8(b, cmd->expand[k]);
+      }
+      out_str(b, cmd->in_path);
+      out_str(b, cmd->out_path);
+      out_u8(b, cmd->out_append);
+      out_str(b, cmd->err_path);
+      out_u8(b, cmd->err_append);
+      out_u8(b, cmd->expand_redirs);
+    }
+  }
+}
+
+static int in_bytes(InBuf *in, void *p, size_t n)
+{
+  if (in->len - in->pos < n)
+    return -1;
+  memcpy(p, in->data + in->pos, n);
+  in->pos += n;
+  return 0;
+}
+
+static int in_u8(InBuf *in, uint8_t *v)
+{
+  return in_bytes(in, v, sizeof(*v));
+}
+
+static int in_u32(InBuf *in, uint32_t *v)
+{
+  return in_bytes(in, v, sizeof(*v));
+}
+
+/* Read a str, copying it into *dst unless dst is NULL (validation only) */
+static int in_str(InBuf *in, char **dst, int nullable)
+{
+  uint32_t len;
+  if (in_u32(in, &len) != 0)
+    return -1;
+  if (len == NO_STRING)
+  {
+    if (!nullable)
+      return -1;
+    if (dst)
+      *dst = NULL;
+    return 0;
+  }
+  if (in->len - in->pos < len)
+    return -1;
+  if (dst)
+  {
+    *dst = strndup((const char *)in->data + in->pos, len);
+    if (!*dst)
+    {
+      perror("strndup");
+      clean_exit(EXIT_FAILURE);
+    }
+  }
+  in->pos += len;
+  return 0;
+}
+
+static void *checked_calloc(size_t n, size_t size)
+{
+  void *p = calloc(n, size);
+  if (!p)
+  {
+    perror("calloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  return p;
+}
+
+/*
+ * Read a serialized list into list, or only check that it is well formed
+ * when list is NULL. On failure list holds what was read so far.
+ */
+static int in_list(InBuf *in, CommandList *list)
+{
+  uint32_t count;
+  if (in_u32(in, &count) != 0 || count > in->len - in->pos)
+    return -1;
+  if (list && count > 0)
+  {
+    list->items = checked_calloc(count, sizeof(Pipeline));
+    list->capacity = count;
+  }
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint8_t op;
+    uint32_t ncmds;
+    if (in_u8(in, &op) != 0 || op > LIST_OR)
+      return -1;
+    if (in_u32(in, &ncmds) != 0 || ncmds == 0 || ncmds > in->len - in->pos)
+      return -1;
+
+    Pipeline *pl = NULL;
+    if (list)
+    {
+      pl = &list->items[list->count++];
+      pl->next_op = op;
+      pl->cmds = checked_calloc(ncmds, sizeof(SimpleCommand));
+      pl->capacity = ncmds;
+    }
+
+    for (uint32_t j = 0; j < ncmds; j++)
+    {
+      SimpleCommand *cmd = pl ? &pl->cmds[pl->ncmds++] : NULL;
+      uint32_t argc;
+      uint8_t append, err_append, expand;
+      if (in_u32(in, &argc) != 0 || argc == 0 || argc > MAX_ARGS)
+        return -1;
+      for (uint32_t k = 0; k < argc; k++)
+      {
+        if (in_str(in, cmd ? &cmd->argv[k] : NULL, 0) != 0)
+          return -1;
+        if (cmd)
+          cmd->argc++;
+        if (in_u8(in, &expand) != 0 || expand > 1)
+          return -1;
+        if (cmd)
+          cmd->expand[k] = expand;
+      }
+      if (in_str(in, cmd ? &cmd->in_path : NULL, 1) != 0 ||
+          in_str(in, cmd ? &cmd->out_path : NULL, 1) != 0 ||
+          in_u8(in, &append) != 0 ||
+          in_str(in, cmd ? &cmd->err_path : NULL, 1) != 0 ||
+          in_u8(in, &err_append) != 0 ||
+          in_u8(in, &expand) != 0 || expand > (EXPAND_IN | EXPAND_OUT | EXPAND_ERR))
+        return -1;
+      if (cmd)
+      {
+        cmd->out_append = append != 0;
+        cmd->err_append = err_append != 0;
+        cmd->expand_redirs = expand;
+      }
+    }
+  }
+  return 0;
+}
+
+/* Check one line record; returns its kind or -1 if it is malformed */
+static int in_line(InBuf *in)
+{
+  uint32_t len;
+  uint8_t kind;
+  if (in_u32(in, &len) != 0 || len >= in->len - in->pos || in->data[in->pos + len] != '\0')
+    return -1;
+  in->pos += len + 1;
+  if (in_u8(in, &kind) != 0)
+    return -1;
+  if (kind == LINE_REPARSE)
+    return kind;
+  if (kind != LINE_PARSED || in_list(in, NULL) != 0)
+    return -1;
+  return kind;
+}
+
+/* Validate the body that starts at offset body and record where each line starts */
+static int index_lines(CompiledScript *cs, size_t body)
+{
+  InBuf in = {cs->data, cs->size, body};
+  uint32_t nlines;
+  if (in_u32(&in, &nlines) != 0 || nlines > cs->size - in.pos)
+    return -1;
+
+  cs->lines = malloc((nlines ? nlines : 1) * sizeof(size_t));
+  if (!cs->lines)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  for (uint32_t i = 0; i < nlines; i++)
+  {
+    cs->lines[i] = in.pos;
+    if (in_line(&in) < 0)
+      return -1;
+  }
+  cs->nlines = nlines;
+  return in.pos == cs->size ? 0 : -1;
+}
+
+/* 64-bit FNV-1a of a string */
+static uint64_t fnv1a(const char *s)
+{
+  uint64_t h = 0xcbf29ce484222325ULL;
+  while (*s)
+  {
+    h ^= (unsigned char)*s++;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+/*
+ * Cache file for a script: $WSH_CACHE_DIR, $XDG_CACHE_HOME/wsh or
+ * ~/.cache/wsh, named after a hash of the script's real path
+ */
+static int cache_file_path(const char *script, char *out, size_t outlen)
+{
+  char dir[PATH_MAX];
+  const char *env_dir = env_get(SCRIPT_CACHE_DIR_ENV);
+  const char *xdg = env_get("XDG_CACHE_HOME");
+  const char *home = env_get("HOME");
+  int n;
+
+  if (env_dir && *env_dir)
+  {
+    n = snprintf(dir, sizeof(dir), "%s", env_dir);
+  }
+  else if (xdg && *xdg)
+  {
+    n = snprintf(dir, sizeof(dir), "%s/wsh", xdg);
+  }
+  else if (home && *home)
+  {
+    n = snprintf(dir, sizeof(dir), "%s/.cache", home);
+    if (n < 0 || (size_t)n >= sizeof(dir))
+      return -1;
+    mkdir(dir, 0700);
+    n = snprintf(dir, sizeof(dir), "%s/.cache/wsh", home);
+  }
+  else
+  {
+    return -1;
+  }
+  if (n < 0 || (size_t)n >= sizeof(dir))
+    return -1;
+  if (mkdir(dir, 0700) != 0 && errno != EEXIST)
+    return -1;
+
+  n = snprintf(out, outlen, "%s/%016llx.wshc", dir, (unsigned long long)fnv1a(script));
+  return n < 0 || (size_t)n >= outlen ? -1 : 0;
+}
+
+/* Map the cache file if it starts with the expected header */
+static int cache_load(const char *file, const OutBuf *header, CompiledScript *cs)
+{
+  int fd = open(file, O_RDONLY | O_CLOEXEC);
+  if (fd == -1)
+    return -1;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size <= header->len)
+  {
+    close(fd);
+    return -1;
+  }
+
+  void *p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+    return -1;
+
+  cs->data = p;
+  cs->size = st.st_size;
+  cs->mapped = 1;
+  if (memcmp(p, header->data, header->len) != 0 || index_lines(cs, header->len) != 0)
+  {
+    script_cache_close(cs);
+    return -1;
+  }
+  return 0;
+}
+
+/* Write the cache file through a temporary so readers never see a partial file */
+static void cache_write(const char *file, const OutBuf *b)
+{
+  char tmp[PATH_MAX];
+  int n = snprintf(tmp, sizeof(tmp), "%s.%ld.tmp", file, (long)getpid());
+  if (n < 0 || (size_t)n >= sizeof(tmp))
+    return;
+
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  if (fd == -1)
+    return;
+
+  size_t off = 0;
+  while (off < b->len)
+  {
+    ssize_t written = write(fd, b->data + off, b->len - off);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    off += written;
+  }
+
+  if (close(fd) != 0 || off != b->len || rename(tmp, file) != 0)
+    unlink(tmp);
+}
+
+/* Read every line of the script (as batch mode's fgets loop does) and serialize it */
+static void compile_script(FILE *fp, OutBuf *b)
+{
+  size_t count_pos = b->len;
+  uint32_t nlines = 0;
+  char cmdline[MAX_LINE];
+
+  out_u32(b, 0);
+  while (fgets(cmdline, MAX_LINE, fp) != NULL)
+  {
+    size_t len = strlen(cmdline);
+    out_u32(b, len);
+    out_bytes(b, cmdline, len + 1);
+
+    CommandList list;
+    if (parse_command_list_quiet(cmdline, &list) == 0)
+    {
+      out_u8(b, LINE_PARSED);
+      out_list(b, &list);
+      command_list_free(&list);
+    }
+    else
+    {
+      out_u8(b, LINE_REPARSE);
+    }
+    nlines++;
+  }
+  memcpy(b->data + count_pos, &nlines, sizeof(nlines));
+}
+
+/**
+ * @Brief Compile a batch script, reusing the cached compilation when the
+ * script, its modification time and size and the alias table are unchanged
+ *
+ * @param path Path the script was opened from
+ * @param fp The open script, positioned at its start
+ * @param alias_digest hm_digest of the alias table
+ * @param cs Filled with the compiled script (release with script_cache_close)
+ * @return 0 on success, -1 if the script cannot be cached (fp is rewound)
+ */
+int script_cache_open(const char *path, FILE *fp, unsigned long long alias_digest,
+                      CompiledScript *cs)
+{
+  ALLOC_SCOPE(ALLOC_PARSER);
+  memset(cs, 0, sizeof(*cs));
+
+  const char *disable = env_get(SCRIPT_CACHE_DISABLE_ENV);
+  if (disable && *disable)
+    return -1;
+
+  struct stat st;
+  char real[PATH_MAX];
+  if (fstat(fileno(fp), &st) != 0 || !S_ISREG(st.st_mode) || !realpath(path, real))
+    return -1;
+
+  OutBuf b = {0};
+  out_bytes(&b, CACHE_MAGIC, 4);
+  out_u32(&b, CACHE_VERSION);
+  out_u64(&b, st.st_mtim.tv_sec);
+  out_u64(&b, st.st_mtim.tv_nsec);
+  out_u64(&b, st.st_size);
+  out_u64(&b, alias_digest);
+  out_str(&b, real);
+  size_t header_len = b.len;
+
+  char file[PATH_MAX];
+  int have_file = cache_file_path(real, file, sizeof(file)) == 0;
+  if (have_file && cache_load(file, &b, cs) == 0)
+  {
+    free(b.data);
+    return 0;
+  }
+
+  compile_script(fp, &b);
+  if (have_file)
+    cache_write(file, &b);
+
+  cs->data = b.data;
+  cs->size = b.len;
+  cs->mapped = 0;
+  if (index_lines(cs, header_len) != 0)
+  {
+    script_cache_close(cs);
+    rewind(fp);
+    return -1;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Text of a line of a compiled script
+ *
+ * @param cs The compiled script
+ * @param i Line index (0 <= i < cs->nlines)
+ * @return The line as read from the script, NUL terminated
+ */
+const char *script_line_text(const CompiledScript *cs, int i)
+{
+  return (const char *)cs->data + cs->lines[i] + sizeof(uint32_t);
+}
+
+/**
+ * @Brief Parsed form of a line of a compiled script
+ *
+ * @param cs The compiled script
+ * @param i Line index (0 <= i < cs->nlines)
+ * @param list Filled with the line's list (free with command_list_free)
+ * @return 1 if list was filled, 0 if the line has a syntax error
+ */
+int script_line_list(const CompiledScript *cs, int i, CommandList *list)
+{
+  ALLOC_SCOPE(ALLOC_PARSER);
+  InBuf in = {cs->data, cs->size, cs->lines[i]};
+  uint32_t len;
+
+  memcpy(&len, in.data + in.pos, sizeof(len));
+  in.pos += sizeof(len) + len + 1;
+  if (in.data[in.pos++] == LINE_REPARSE)
+    return 0;
+
+  memset(list, 0, sizeof(*list));
+  if (in_list(&in, list) != 0)
+  {
+    /* The body was validated when the script was opened */
+    command_list_free(list);
+    return 0;
+  }
+  return 1;
+}
+
+/**
+ * @Brief Release a compiled script
+ *
+ * @param cs The compiled script (left empty)
+ */
+void script_cache_close(CompiledScript *cs)
+{
+  if (cs->data)
+  {
+    if (cs->mapped)
+      munmap(cs->data, cs->size);
+    else
+      free(cs->data);
+  }
+  free(cs->lines);
+  memset(cs, 0, sizeof(*cs));
+}
@@ -0,0 +1,453 @@
+#define _GNU_SOURCE // accept4, SO_PEERCRED, MSG_CMSG_CLOEXEC
+#include "../include/server.h"
+#include "../include/wsh.h"
+#include "../include/env.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define REQUEST_MAGIC 0x57534852 // "WSHR"
+
+/*
+ * Request header, sent with the client's stdin, stdout and stderr attached
+ * as SCM_RIGHTS; followed by cwd_len bytes of working directory and
+ * text_len bytes of script path or command line. The server answers with
+ * the request's exit status as an int32_t.
+ */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t kind;
+  uint32_t cwd_len;
+  uint32_t text_len;
+} RequestHeader;
+
+/* Where exit returns to while a request is running */
+static jmp_buf request_exit;
+
+/**
+ * @Brief Socket path of the server
+ *
+ * @param buf Receives the path
+ * @param len Size of buf
+ * @return 0 on success, -1 if the path does not fit
+ */
+int server_socket_path(char *buf, size_t len)
+{
+  const char *env_path = env_get(SERVER_SOCKET_ENV);
+  const char *runtime_dir = env_get("XDG_RUNTIME_DIR");
+  int n;
+
+  if (env_path && *env_path)
+    n = snprintf(buf, len, "%s", env_path);
+  else if (runtime_dir && *runtime_dir)
+    n = snprintf(buf, len, "%s/wsh.sock", runtime_dir);
+  else
+    n = snprintf(buf, len, "/tmp/wsh-%ld.sock", (long)getuid());
+
+  if (n < 0 || (size_t)n >= len || (size_t)n >= sizeof(((struct sockaddr_un *)0)->sun_path))
+  {
+    wsh_warn(SOCKET_PATH_TOO_LONG);
+    return -1;
+  }
+  return 0;
+}
+
+static void socket_address(const char *path, struct sockaddr_un *addr)
+{
+  memset(addr, 0, sizeof(*addr));
+  addr->sun_family = AF_UNIX;
+  strcpy(addr->sun_path, path);
+}
+
+/* Read exactly len bytes; -1 on error or early end of stream */
+static int read_full(int fd, void *buf, size_t len)
+{
+  char *p = buf;
+  while (len > 0)
+  {
+    ssize_t n = read(fd, p, len);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return -1;
+    p += n;
+    len -= n;
+  }
+  return 0;
+}
+
+/* Write exactly len bytes without raising SIGPIPE */
+static int write_full(int fd, const void *buf, size_t len)
+{
+  const char *p = buf;
+  while (len > 0)
+  {
+    ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n < 0)
+      return -1;
+    p += n;
+    len -= n;
+  }
+  return 0;
+}
+
+/* Receive a request header and the three descriptors attached to it */
+static int receive_header(int conn, RequestHeader *hdr, int fds[3])
+{
+  union
+  {
+    char buf[CMSG_SPACE(3 * sizeof(int))];
+    struct cmsghdr align;
+  } control;
+  struct iovec iov = {hdr, sizeof(*hdr)};
+  struct msghdr msg = {0};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+
+  ssize_t n;
+  do
+  {
+    n = recvmsg(conn, &msg, MSG_CMSG_CLOEXEC);
+  } while (n < 0 && errno == EINTR);
+
+  /* The control buffer is only filled in by a successful receive */
+  if (n <= 0)
+  {
+    return -1;
+  }
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  if (!cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+  {
+    return -1;
+  }
+  if (cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int)) || (msg.msg_flags & MSG_CTRUNC))
+  {
+    /* Close whatever descriptors did arrive */
+    size_t nfds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    size_t room = (sizeof(control.buf) - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < nfds && i < room; i++)
+    {
+      int fd;
+      memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+      close(fd);
+    }
+    return -1;
+  }
+  memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+  /* The header is small, but a stream socket may still split it */
+  if ((size_t)n > sizeof(*hdr) ||
+      read_full(conn, (char *)hdr + n, sizeof(*hdr) - n) != 0 ||
+      hdr->magic != REQUEST_MAGIC || hdr->cwd_len >= PATH_MAX ||
+      hdr->text_len >= (hdr->kind == REQUEST_SCRIPT ? PATH_MAX : MAX_LINE))
+  {
+    for (int i = 0; i < 3; i++)
+      close(fds[i]);
+    return -1;
+  }
+  return 0;
+}
+
+/*
+ * Run one request with the client's descriptors as stdin, stdout and
+ * stderr and its working directory as cwd; the shell's own descriptors
+ * and directory are restored afterwards
+ */
+static int32_t serve_request(const RequestHeader *hdr, int fds[3], const char *cwd,
+                             const char *text, int home_dir)
+{
+  int saved[3];
+  int32_t status;
+
+  fflush(stdout);
+  fflush(stderr);
+  for (int fd = 0; fd < 3; fd++)
+  {
+    saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, 3);
+    dup2(fds[fd], fd);
+    close(fds[fd]);
+  }
+
+  if (chdir(cwd) != 0)
+  {
+    perror(cwd);
+    status = EXIT_FAILURE;
+  }
+  else
+  {
+    exit_jmp = &request_exit;
+    if (setjmp(request_exit) == 0)
+    {
+      if (hdr->kind == REQUEST_SCRIPT)
+      {
+        status = batch_main(text);
+      }
+      else
+      {
+        execute_command(text);
+        status = rc;
+      }
+    }
+    else
+    {
+      // exit was run: end the request, not the server
+      batch_free();
+      status = rc;
+    }
+    exit_jmp = NULL;
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+  clearerr(stdout);
+  clearerr(stderr);
+  for (int fd = 0; fd < 3; fd++)
+  {
+    if (saved[fd] != -1)
+    {
+      dup2(saved[fd], fd);
+      close(saved[fd]);
+    }
+  }
+  if (fchdir(home_dir) != 0)
+  {
+    perror("fchdir");
+  }
+  return status;
+}
+
+/* Accept requests from the socket's owner only */
+static int peer_is_owner(int conn)
+{
+  struct ucred cred;
+  socklen_t len = sizeof(cred);
+  return getsockopt(conn, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0 && cred.uid == getuid();
+}
+
+/* Read the request on conn, run it and send back its status */
+static void handle_connection(int conn, int home_dir)
+{
+  RequestHeader hdr;
+  int fds[3];
+  char cwd[PATH_MAX];
+  char text[PATH_MAX > MAX_LINE ? PATH_MAX : MAX_LINE];
+
+  if (!peer_is_owner(conn) || receive_header(conn, &hdr, fds) != 0)
+    return;
+
+  if (read_full(conn, cwd, hdr.cwd_len) != 0 || read_full(conn, text, hdr.text_len) != 0)
+  {
+    for (int i = 0; i < 3; i++)
+      close(fds[i]);
+    return;
+  }
+  cwd[hdr.cwd_len] = '\0';
+  if (hdr.kind == REQUEST_COMMAND)
+  {
+    // Terminate the line as fgets would, so history entries look alike
+    text[hdr.text_len++] = '\n';
+  }
+  text[hdr.text_len] = '\0';
+
+  int32_t status = serve_request(&hdr, fds, cwd, text, home_dir);
+  write_full(conn, &status, sizeof(status));
+}
+
+/* Bind the listening socket, replacing a stale socket file left by a dead server */
+static int listen_socket(const char *path)
+{
+  struct sockaddr_un addr;
+  socket_address(path, &addr);
+
+  int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (probe == -1)
+  {
+    perror("socket");
+    return -1;
+  }
+  if (connect(probe, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+  {
+    close(probe);
+    wsh_warn(SERVER_ALREADY_RUNNING, path);
+    return -1;
+  }
+  int probe_errno = errno;
+  close(probe);
+  if (probe_errno == ECONNREFUSED)
+    unlink(path);
+
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (sock == -1)
+  {
+    perror("socket");
+    return -1;
+  }
+
+  mode_t old_mask = umask(0077);
+  int bound = bind(sock, (struct sockaddr *)&addr, sizeof(addr));
+  umask(old_mask);
+  if (bound != 0 || listen(sock, SOMAXCONN) != 0)
+  {
+    perror(path);
+    close(sock);
+    return -1;
+  }
+  return sock;
+}
+
+/**
+ * @Brief Server mode: keep the shell state (aliases, PATH, history) warm
+ * and run the requests of wsh --client one at a time
+ *
+ * @return EXIT_FAILURE if the socket cannot be set up (otherwise runs
+ * until the process is killed)
+ */
+int server_main(void)
+{
+  char path[PATH_MAX];
+  if (server_socket_path(path, sizeof(path)) != 0)
+    return EXIT_FAILURE;
+
+  int home_dir = open(".", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (home_dir == -1)
+  {
+    perror("open");
+    return EXIT_FAILURE;
+  }
+
+  int sock = listen_socket(path);
+  if (sock == -1)
+  {
+    close(home_dir);
+    return EXIT_FAILURE;
+  }
+
+  for (;;)
+  {
+    int conn = accept4(sock, NULL, NULL, SOCK_CLOEXEC);
+    if (conn == -1)
+    {
+      if (errno != EINTR && errno != ECONNABORTED)
+        perror("accept");
+      continue;
+    }
+    handle_connection(conn, home_dir);
+    close(conn);
+  }
+}
+
+/**
+ * @Brief Client mode: run a script (or -c command line) on the server
+ *
+ * @param argc Number of arguments after --client
+ * @param argv The arguments after --client
+ * @return The exit status of the request, EXIT_FAILURE on errors
+ */
+int client_main(int argc, char **argv)
+{
+  RequestHeader hdr = {REQUEST_MAGIC, REQUEST_SCRIPT, 0, 0};
+  const char *text;
+
+  if (argc == 1 && strcmp(argv[0], "-c") != 0)
+  {
+    text = argv[0];
+  }
+  else if (argc == 2 && strcmp(argv[0], "-c") == 0)
+  {
+    hdr.kind = REQUEST_COMMAND;
+    text = argv[1];
+  }
+  else
+  {
+    wsh_warn(INVALID_WSH_USE);
+    return EXIT_FAILURE;
+  }
+
+  char cwd[PATH_MAX];
+  if (!getcwd(cwd, sizeof(cwd)))
+  {
+    perror("getcwd");
+    return EXIT_FAILURE;
+  }
+  hdr.cwd_len = strlen(cwd);
+  hdr.text_len = strlen(text);
+  if (hdr.text_len >= (hdr.kind == REQUEST_SCRIPT ? PATH_MAX : MAX_LINE))
+  {
+    wsh_warn(REQUEST_TOO_LONG);
+    return EXIT_FAILURE;
+  }
+
+  char path[PATH_MAX];
+  if (server_socket_path(path, sizeof(path)) != 0)
+    return EXIT_FAILURE;
+
+  struct sockaddr_un addr;
+  socket_address(path, &addr);
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (sock == -1)
+  {
+    perror("socket");
+    return EXIT_FAILURE;
+  }
+  if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+  {
+    wsh_warn(SERVER_UNAVAILABLE, path, strerror(errno));
+    close(sock);
+    return EXIT_FAILURE;
+  }
+
+  int fds[3] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+  union
+  {
+    char buf[CMSG_SPACE(sizeof(fds))];
+    struct cmsghdr align;
+  } control;
+  memset(&control, 0, sizeof(control));
+  struct iovec iov = {&hdr, sizeof(hdr)};
+  struct msghdr msg = {0};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control.buf;
+  msg.msg_controllen = sizeof(control.buf);
+  struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+  int32_t status;
+  ssize_t sent;
+  do
+  {
+    sent = sendmsg(sock, &msg, MSG_NOSIGNAL);
+  } while (sent < 0 && errno == EINTR);
+
+  if (sent < 0 ||
+      write_full(sock, (char *)&hdr + sent, sizeof(hdr) - sent) != 0 ||
+      write_full(sock, cwd, hdr.cwd_len) != 0 ||
+      write_full(sock, text, hdr.text_len) != 0 ||
+      read_full(sock, &status, sizeof(status)) != 0)
+  {
+    wsh_warn(SERVER_UNAVAILABLE, path, "request failed");
+    close(sock);
+    return EXIT_FAILURE;
+  }
+
+  close(sock);
+  return status;
+}
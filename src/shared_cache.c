@@ -0,0 +1,648 @@
+#include "../include/shared_cache.h"
+#include "../include/env.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ * One segment per user (/dev/shm/wsh-<uid>-v<version>), mapped by every
+ * wsh process started with WSH_SHARED_CACHE set. It holds two tables that
+ * are read far more often than they are written:
+ *  - the rc file compiled as rc_load does it: the index of its alias
+ *    definitions by name and its other lines, valid while the file's
+ *    identity (device, inode, size, mtime) is unchanged;
+ *  - command names resolved under one PATH, valid while the PATH string
+ *    and the inode and mtime of each of its directories are unchanged, so
+ *    adding or removing a command starts a new table.
+ *
+ * Writers take a record lock on the segment (per process, so forked
+ * children exclude each other too) and make the sequence number odd while
+ * they change anything. Readers take no lock: they copy what they need
+ * and start again if the sequence number moved (a seqlock). Offsets read
+ * during a write may be torn, so every range is bounds checked before it
+ * is copied. A writer that finds the sequence odd knows the previous one
+ * died mid-update and clears the segment.
+ */
+#define SHARED_VERSION 1
+#define SHARED_MAGIC 0x63687377u  // "wshc"
+#define ALIAS_SLOTS 2048          // power of two; at most half are used
+#define ALIAS_HEAP (512 * 1024)
+#define PATH_SLOTS 4096           // power of two; cleared when 3/4 full
+#define PATH_HEAP (512 * 1024)
+#define SEQLOCK_RETRIES 100
+#define FNV_OFFSET 0xcbf29ce484222325ULL
+
+// Hash table slot; the key and value are byte ranges of the table's heap
+typedef struct {
+  uint64_t hash;
+  uint32_t key_off;
+  uint32_t key_len;    // 0: empty slot
+  uint32_t value_off;
+  uint32_t value_len;
+} Slot;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t seq;              // Odd while a writer is changing the segment
+  uint64_t rc_identity;      // 0: no rc file stored
+  uint64_t rc_digest;        // Digest of the rc alias definitions
+  uint32_t rc_commands_off;  // Other rc lines, each NUL terminated
+  uint32_t rc_commands_len;
+  uint32_t alias_count;
+  uint32_t alias_heap_used;
+  uint64_t path_identity;    // 0: no paths stored
+  uint32_t path_count;
+  uint32_t path_heap_used;
+  Slot alias_slots[ALIAS_SLOTS];
+  Slot path_slots[PATH_SLOTS];
+  char alias_heap[ALIAS_HEAP];
+  char path_heap[PATH_HEAP];
+} SharedSegment;
+
+static SharedSegment *seg = NULL;
+static int seg_fd = -1;
+static unsigned long long rc_matched = 0;    // Identity of the rc file in use
+static unsigned long long path_identity = 0; // Of the current PATH (0: not shared)
+static int path_identity_known = 0;
+
+static uint64_t fnv1a(uint64_t h, const void *data, size_t n)
+{
+  const unsigned char *p = data;
+  for (size_t i = 0; i < n; i++)
+  {
+    h ^= p[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+/***************************************************
+ * Locking
+ ***************************************************/
+
+static int segment_lock(short type)
+{
+  struct flock fl = {.l_type = type, .l_whence = SEEK_SET, .l_start = 0, .l_len = 1};
+  while (fcntl(seg_fd, F_SETLKW, &fl) == -1)
+  {
+    if (errno != EINTR)
+      return -1;
+  }
+  return 0;
+}
+
+static void clear_rc(void)
+{
+  seg->rc_identity = 0;
+  seg->rc_digest = 0;
+  seg->rc_commands_off = 0;
+  seg->rc_commands_len = 0;
+  seg->alias_count = 0;
+  seg->alias_heap_used = 0;
+  memset(seg->alias_slots, 0, sizeof(seg->alias_slots));
+}
+
+static void clear_paths(void)
+{
+  seg->path_identity = 0;
+  seg->path_count = 0;
+  seg->path_heap_used = 0;
+  memset(seg->path_slots, 0, sizeof(seg->path_slots));
+}
+
+/* Take the writer lock and make the sequence odd */
+static int write_begin(void)
+{
+  if (segment_lock(F_WRLCK) == -1)
+    return -1;
+
+  uint32_t seq = seg->seq;
+  if (seq & 1 || seg->magic != SHARED_MAGIC)
+  {
+    // A new segment, or a writer died halfway: start from nothing
+    __atomic_store_n(&seg->seq, seq | 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    clear_rc();
+    clear_paths();
+    seg->magic = SHARED_MAGIC;
+    return 0;
+  }
+  __atomic_store_n(&seg->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  return 0;
+}
+
+/* Make the sequence even again and release the writer lock */
+static void write_end(void)
+{
+  __atomic_store_n(&seg->seq, seg->seq + 1, __ATOMIC_RELEASE);
+  segment_lock(F_UNLCK);
+}
+
+/* Sequence number to validate a read against; 0 if writers keep it busy */
+static int read_begin(uint32_t *seq)
+{
+  for (int i = 0; i < SEQLOCK_RETRIES; i++)
+  {
+    *seq = __atomic_load_n(&seg->seq, __ATOMIC_ACQUIRE);
+    if (!(*seq & 1))
+      return 1;
+    sched_yield();
+  }
+  return 0;
+}
+
+/* Whether a read that started at seq saw a write and must be repeated */
+static int read_retry(uint32_t seq)
+{
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  return __atomic_load_n(&seg->seq, __ATOMIC_RELAXED) != seq;
+}
+
+/***************************************************
+ * Tables
+ ***************************************************/
+
+static int heap_range(uint32_t off, uint32_t len, size_t heap_size)
+{
+  return off <= heap_size && len <= heap_size - off;
+}
+
+/* Slot holding key, or the empty slot where it belongs; NULL if none */
+static Slot *table_find(Slot *slots, size_t nslots, const char *heap, size_t heap_size,
+                        const char *key, size_t len, uint64_t hash)
+{
+  for (size_t i = 0; i < nslots; i++)
+  {
+    Slot *s = &slots[(hash + i) & (nslots - 1)];
+    uint32_t key_off = s->key_off;
+    uint32_t key_len = s->key_len;
+    if (key_len == 0)
+      return s;
+    if (s->hash == hash && key_len == len && heap_range(key_off, key_len, heap_size) &&
+        memcmp(heap + key_off, key, len) == 0)
+      return s;
+  }
+  return NULL;
+}
+
+/* Append the value of a slot to out; 0 if its range is not valid */
+static int copy_value(const Slot *s, const char *heap, size_t heap_size, StrBuf *out)
+{
+  uint32_t off = s->value_off;
+  uint32_t len = s->value_len;
+  if (!heap_range(off, len, heap_size))
+    return 0;
+  sb_append(out, heap + off, len);
+  return 1;
+}
+
+/* Copy n bytes to the end of a heap; -1 if they do not fit */
+static int heap_put(char *heap, size_t heap_size, uint32_t *used, const char *s, size_t n,
+                    uint32_t *off)
+{
+  if (n > heap_size - *used)
+    return -1;
+  memcpy(heap + *used, s, n);
+  *off = *used;
+  *used += n;
+  return 0;
+}
+
+/* Fill the empty slot s with a key and value (writer only) */
+static int slot_put(Slot *s, char *heap, size_t heap_size, uint32_t *used, uint64_t hash,
+                    const char *key, size_t key_len, const char *value, size_t value_len)
+{
+  uint32_t key_off, value_off;
+  if (heap_put(heap, heap_size, used, key, key_len, &key_off) == -1 ||
+      heap_put(heap, heap_size, used, value, value_len, &value_off) == -1)
+    return -1;
+  s->hash = hash;
+  s->key_off = key_off;
+  s->value_off = value_off;
+  s->value_len = value_len;
+  s->key_len = key_len;
+  return 0;
+}
+
+/***************************************************
+ * Segment
+ ***************************************************/
+
+/**
+ * @Brief Map the shared segment when the cache is enabled
+ *
+ * The first process to open the segment sizes it; tmpfs allocates its
+ * pages only as they are written.
+ *
+ * @return 0 if the segment is mapped, -1 if the cache is off or unusable
+ */
+int shared_cache_attach(void)
+{
+  if (seg)
+    return 0;
+  const char *enabled = env_get(SHARED_CACHE_ENV);
+  if (!enabled || !*enabled)
+    return -1;
+
+  char name[64];
+  snprintf(name, sizeof(name), "/wsh-%ld-v%d", (long)getuid(), SHARED_VERSION);
+  int fd = shm_open(name, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd == -1)
+    return -1;
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 || st.st_uid != getuid() ||
+      ((size_t)st.st_size != sizeof(SharedSegment) && ftruncate(fd, sizeof(SharedSegment)) == -1))
+  {
+    close(fd);
+    return -1;
+  }
+  void *p = mmap(NULL, sizeof(SharedSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (p == MAP_FAILED)
+  {
+    close(fd);
+    return -1;
+  }
+  seg = p;
+  seg_fd = fd;
+
+  if (__atomic_load_n(&seg->magic, __ATOMIC_ACQUIRE) != SHARED_MAGIC && write_begin() == 0)
+    write_end();
+  return 0;
+}
+
+/**
+ * @Brief Unmap the shared segment
+ */
+void shared_cache_detach(void)
+{
+  if (!seg)
+    return;
+  munmap(seg, sizeof(SharedSegment));
+  close(seg_fd);
+  seg = NULL;
+  seg_fd = -1;
+  rc_matched = 0;
+}
+
+/***************************************************
+ * rc file
+ ***************************************************/
+
+/**
+ * @Brief Identity of an rc file
+ *
+ * @param path Path of the rc file
+ * @return Hash of its path, device, inode, size and mtime; 0 if it cannot
+ *         be read
+ */
+unsigned long long shared_rc_identity(const char *path)
+{
+  struct stat st;
+  if (!seg || stat(path, &st) == -1)
+    return 0;
+
+  uint64_t h = fnv1a(FNV_OFFSET, path, strlen(path));
+  h = fnv1a(h, &st.st_dev, sizeof(st.st_dev));
+  h = fnv1a(h, &st.st_ino, sizeof(st.st_ino));
+  h = fnv1a(h, &st.st_size, sizeof(st.st_size));
+  h = fnv1a(h, &st.st_mtim, sizeof(st.st_mtim));
+  return h ? h : 1;
+}
+
+/**
+ * @Brief Use the compiled rc file from the segment if it is current
+ *
+ * @param identity Identity of the rc file (shared_rc_identity)
+ * @param commands Receives its non-alias lines, each NUL terminated
+ * @param digest Receives the digest of its alias definitions
+ * @return 1 if the segment holds the file, 0 if it must be read
+ */
+int shared_rc_match(unsigned long long identity, StrBuf *commands, unsigned long long *digest)
+{
+  if (!seg || identity == 0)
+    return 0;
+
+  size_t start = commands->len;
+  for (int attempt = 0; attempt < SEQLOCK_RETRIES; attempt++)
+  {
+    uint32_t seq;
+    if (!read_begin(&seq))
+      break;
+    int hit = seg->rc_identity == identity;
+    uint64_t d = seg->rc_digest;
+    uint32_t off = seg->rc_commands_off;
+    uint32_t len = seg->rc_commands_len;
+    if (hit && heap_range(off, len, ALIAS_HEAP))
+      sb_append(commands, seg->alias_heap + off, len);
+    if (!read_retry(seq))
+    {
+      if (hit)
+      {
+        rc_matched = identity;
+        *digest = d;
+      }
+      return hit;
+    }
+    sb_truncate(commands, start);
+  }
+  return 0;
+}
+
+/**
+ * @Brief Look up the rc line defining an alias
+ *
+ * @param name The alias name
+ * @param line Receives the line (NULL to only test for the alias)
+ * @return 1 if the rc file defines the alias
+ */
+int shared_rc_alias(const char *name, StrBuf *line)
+{
+  if (!seg || !rc_matched)
+    return 0;
+
+  size_t len = strlen(name);
+  uint64_t hash = fnv1a(FNV_OFFSET, name, len);
+  size_t start = line ? line->len : 0;
+  for (int attempt = 0; attempt < SEQLOCK_RETRIES; attempt++)
+  {
+    uint32_t seq;
+    if (!read_begin(&seq))
+      break;
+    int found = 0;
+    if (seg->rc_identity == rc_matched)
+    {
+      Slot *s = table_find(seg->alias_slots, ALIAS_SLOTS, seg->alias_heap, ALIAS_HEAP,
+                           name, len, hash);
+      found = s && s->key_len != 0 && (!line || copy_value(s, seg->alias_heap, ALIAS_HEAP, line));
+    }
+    if (!read_retry(seq))
+      return found;
+    if (line)
+      sb_truncate(line, start);
+  }
+  return 0;
+}
+
+/**
+ * @Brief Copy every rc alias definition
+ *
+ * @param pairs Receives name\0line\0 for each alias
+ */
+void shared_rc_aliases(StrBuf *pairs)
+{
+  if (!seg || !rc_matched)
+    return;
+
+  size_t start = pairs->len;
+  for (int attempt = 0; attempt < SEQLOCK_RETRIES; attempt++)
+  {
+    uint32_t seq;
+    if (!read_begin(&seq))
+      break;
+    if (seg->rc_identity == rc_matched)
+    {
+      for (size_t i = 0; i < ALIAS_SLOTS; i++)
+      {
+        const Slot *s = &seg->alias_slots[i];
+        uint32_t key_off = s->key_off;
+        uint32_t key_len = s->key_len;
+        if (key_len == 0 || !heap_range(key_off, key_len, ALIAS_HEAP))
+          continue;
+        sb_append(pairs, seg->alias_heap + key_off, key_len);
+        sb_append(pairs, "", 1);
+        copy_value(s, seg->alias_heap, ALIAS_HEAP, pairs);
+        sb_append(pairs, "", 1);
+      }
+    }
+    if (!read_retry(seq))
+      return;
+    sb_truncate(pairs, start);
+  }
+}
+
+/**
+ * @Brief Store a compiled rc file for the other processes
+ *
+ * @param identity Identity of the rc file when it was read
+ * @param aliases Its alias definitions as name\0line\0 pairs
+ * @param commands Its other lines, each NUL terminated
+ * @param digest Digest of the alias definitions
+ */
+void shared_rc_publish(unsigned long long identity, const StrBuf *aliases,
+                       const StrBuf *commands, unsigned long long digest)
+{
+  if (!seg || identity == 0 || write_begin() == -1)
+    return;
+
+  if (seg->rc_identity != identity)
+  {
+    clear_rc();
+    int ok = heap_put(seg->alias_heap, ALIAS_HEAP, &seg->alias_heap_used,
+                      commands->data ? commands->data : "", commands->len,
+                      &seg->rc_commands_off) == 0;
+    seg->rc_commands_len = commands->len;
+
+    for (size_t i = 0; ok && i < aliases->len;)
+    {
+      const char *name = aliases->data + i;
+      size_t name_len = strlen(name);
+      const char *line = name + name_len + 1;
+      size_t line_len = strlen(line);
+      i += name_len + line_len + 2;
+
+      uint64_t hash = fnv1a(FNV_OFFSET, name, name_len);
+      Slot *s = table_find(seg->alias_slots, ALIAS_SLOTS, seg->alias_heap, ALIAS_HEAP,
+                           name, name_len, hash);
+      if (!s || seg->alias_count >= ALIAS_SLOTS / 2)
+      {
+        ok = 0;
+      }
+      else if (s->key_len == 0)
+      {
+        ok = slot_put(s, seg->alias_heap, ALIAS_HEAP, &seg->alias_heap_used, hash,
+                      name, name_len, line, line_len) == 0;
+        seg->alias_count++;
+      }
+      else
+      {
+        // Defined again later in the file: the last definition wins
+        ok = heap_put(seg->alias_heap, ALIAS_HEAP, &seg->alias_heap_used, line, line_len,
+                      &s->value_off) == 0;
+        s->value_len = line_len;
+      }
+    }
+
+    if (ok)
+    {
+      seg->rc_identity = identity;
+      seg->rc_digest = digest;
+    }
+    else
+    {
+      clear_rc();
+    }
+  }
+  write_end();
+}
+
+/***************************************************
+ * Command paths
+ ***************************************************/
+
+/* Identity of PATH: the string and each directory's inode and mtime; 0
+   if a directory is relative, since its commands depend on the cwd */
+static unsigned long long compute_path_identity(void)
+{
+  const char *path = env_get("PATH");
+  if (!path || !*path)
+    return 0;
+
+  uint64_t h = fnv1a(FNV_OFFSET, path, strlen(path));
+  for (const char *p = path; *p;)
+  {
+    size_t n = strcspn(p, ":");
+    if (n > 0)
+    {
+      char dir[PATH_MAX];
+      struct stat st;
+      if (p[0] != '/' || n >= sizeof(dir))
+        return 0;
+      memcpy(dir, p, n);
+      dir[n] = '\0';
+      if (stat(dir, &st) == 0)
+      {
+        h = fnv1a(h, &st.st_dev, sizeof(st.st_dev));
+        h = fnv1a(h, &st.st_ino, sizeof(st.st_ino));
+        h = fnv1a(h, &st.st_mtim, sizeof(st.st_mtim));
+      }
+      else
+      {
+        h = fnv1a(h, "-", 1);
+      }
+    }
+    p += n;
+    if (*p == ':')
+      p++;
+  }
+  return h ? h : 1;
+}
+
+static unsigned long long current_path_identity(void)
+{
+  if (!path_identity_known)
+  {
+    path_identity = compute_path_identity();
+    path_identity_known = 1;
+  }
+  return path_identity;
+}
+
+/**
+ * @Brief Path of a command resolved by any process under the same PATH
+ *
+ * A hit is checked with access(), so a command removed or made
+ * non-executable since it was recorded is not returned. The PATH identity
+ * is worked out again for every lookup: a command added to a directory
+ * earlier in PATH changes that directory's mtime, so the table no longer
+ * matches and the command is searched for rather than shadowed.
+ *
+ * @param name The command name
+ * @return Its full path (caller frees), or NULL to search for it
+ */
+char *shared_path_lookup(const char *name)
+{
+  if (!seg)
+    return NULL;
+  path_identity_known = 0;
+  unsigned long long identity = current_path_identity();
+  if (identity == 0)
+    return NULL;
+
+  size_t len = strlen(name);
+  uint64_t hash = fnv1a(FNV_OFFSET, name, len);
+  StrBuf path = STRBUF_INIT;
+  int found = 0;
+  for (int attempt = 0; attempt < SEQLOCK_RETRIES; attempt++)
+  {
+    uint32_t seq;
+    if (!read_begin(&seq))
+      break;
+    found = 0;
+    sb_truncate(&path, 0);
+    if (seg->path_identity == identity)
+    {
+      Slot *s = table_find(seg->path_slots, PATH_SLOTS, seg->path_heap, PATH_HEAP,
+                           name, len, hash);
+      found = s && s->key_len != 0 && copy_value(s, seg->path_heap, PATH_HEAP, &path);
+    }
+    if (!read_retry(seq))
+      break;
+    found = 0;
+  }
+
+  if (found && access(path.data, X_OK) == 0)
+    return sb_release(&path);
+  sb_free(&path);
+  return NULL;
+}
+
+/**
+ * @Brief Record where a command was found
+ *
+ * If the segment holds paths for another PATH identity, this process's
+ * view is refreshed first: only a process that still disagrees replaces
+ * the table, so one started before a directory changed cannot undo the
+ * table of one started after.
+ *
+ * @param name The command name
+ * @param path Its full path
+ */
+void shared_path_publish(const char *name, const char *path)
+{
+  if (!seg)
+    return;
+  unsigned long long identity = current_path_identity();
+  if (identity != 0 && __atomic_load_n(&seg->path_identity, __ATOMIC_RELAXED) != identity)
+  {
+    shared_path_invalidate();
+    identity = current_path_identity();
+  }
+  if (identity == 0 || write_begin() == -1)
+    return;
+
+  size_t name_len = strlen(name);
+  size_t path_len = strlen(path);
+  if (seg->path_identity != identity || seg->path_count >= PATH_SLOTS / 4 * 3 ||
+      name_len + path_len > PATH_HEAP - seg->path_heap_used)
+  {
+    clear_paths();
+    seg->path_identity = identity;
+  }
+
+  uint64_t hash = fnv1a(FNV_OFFSET, name, name_len);
+  Slot *s = table_find(seg->path_slots, PATH_SLOTS, seg->path_heap, PATH_HEAP, name, name_len, hash);
+  if (s && s->key_len == 0 &&
+      slot_put(s, seg->path_heap, PATH_HEAP, &seg->path_heap_used, hash,
+               name, name_len, path, path_len) == 0)
+    seg->path_count++;
+  write_end();
+}
+
+/**
+ * @Brief Work out the PATH identity again on the next lookup
+ */
+void shared_path_invalidate(void)
+{
+  path_identity_known = 0;
+}
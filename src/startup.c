@@ -0,0 +1,68 @@
+#include "../include/startup.h"
+
+#include <time.h>
+
+typedef struct {
+  const char *name;
+  double usec;
+} StartupPhase;
+
+static int profiling;
+static struct timespec last_mark;
+static StartupPhase phases[STARTUP_MAX_PHASES];
+static int nphases;
+
+static double usec_since(const struct timespec *t, struct timespec *now)
+{
+  clock_gettime(CLOCK_MONOTONIC, now);
+  return (now->tv_sec - t->tv_sec) * 1e6 + (now->tv_nsec - t->tv_nsec) / 1e3;
+}
+
+/**
+ * @Brief Enable phase timing and start the clock
+ */
+void startup_profile_begin(void)
+{
+  profiling = 1;
+  nphases = 0;
+  clock_gettime(CLOCK_MONOTONIC, &last_mark);
+}
+
+/**
+ * @Brief Record the time since the previous mark as a phase
+ *
+ * @param name Name of the phase that just finished (a string literal)
+ */
+void startup_phase(const char *name)
+{
+  if (!profiling || nphases == STARTUP_MAX_PHASES)
+    return;
+
+  struct timespec now;
+  phases[nphases].name = name;
+  phases[nphases].usec = usec_since(&last_mark, &now);
+  nphases++;
+  last_mark = now;
+}
+
+/**
+ * @Brief Print the recorded phases and their total, then stop profiling
+ *
+ * @param out Stream to print to
+ */
+void startup_report(FILE *out)
+{
+  if (!profiling)
+    return;
+  profiling = 0;
+
+  double total = 0;
+  fprintf(out, "%-16s %10s\n", "phase", "usec");
+  for (int i = 0; i < nphases; i++)
+  {
+    fprintf(out, "%-16s %10.1f\n", phases[i].name, phases[i].usec);
+    total += phases[i].usec;
+  }
+  fprintf(out, "%-16s %10.1f\n", "total", total);
+  fflush(out);
+}
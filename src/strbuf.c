@@ -0,0 +1,213 @@
+#include "../include/strbuf.h"
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Capacity of the first allocation
+#define STRBUF_MIN_CAPACITY 64
+
+extern void clean_exit(int return_code);
+
+/**
+ * @Brief Make room for more bytes
+ *
+ * The capacity at least doubles on each growth, so a sequence of appends
+ * reallocates only a logarithmic number of times.
+ *
+ * @param sb The buffer
+ * @param extra Number of bytes about to be added after len
+ */
+void sb_reserve(StrBuf *sb, size_t extra)
+{
+  if (sb->len + extra + 1 <= sb->capacity)
+    return;
+
+  size_t capacity = sb->capacity ? sb->capacity : STRBUF_MIN_CAPACITY;
+  while (sb->len + extra + 1 > capacity)
+  {
+    if (capacity * 2 < capacity)
+    {
+      fprintf(stderr, "realloc: string too long\n");
+      clean_exit(EXIT_FAILURE);
+    }
+    capacity *= 2;
+  }
+  char *grown = realloc(sb->data, capacity);
+  if (!grown)
+  {
+    perror("realloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  sb->data = grown;
+  sb->capacity = capacity;
+  sb->data[sb->len] = '\0';
+}
+
+/**
+ * @Brief Append bytes to the end of the string
+ *
+ * @param sb The buffer
+ * @param s Bytes to append
+ * @param n Number of bytes
+ */
+void sb_append(StrBuf *sb, const char *s, size_t n)
+{
+  sb_reserve(sb, n);
+  memcpy(sb->data + sb->len, s, n);
+  sb->len += n;
+  sb->data[sb->len] = '\0';
+}
+
+/**
+ * @Brief Append a NUL terminated string
+ *
+ * @param sb The buffer
+ * @param s String to append
+ */
+void sb_appends(StrBuf *sb, const char *s)
+{
+  sb_append(sb, s, strlen(s));
+}
+
+/**
+ * @Brief Append formatted text
+ *
+ * The text is formatted straight into the free space; only when it does
+ * not fit is the buffer grown and the text formatted a second time.
+ *
+ * @param sb The buffer
+ * @param fmt printf format string
+ * @param ... Arguments for the format string
+ */
+void sb_printf(StrBuf *sb, const char *fmt, ...)
+{
+  va_list args;
+  sb_reserve(sb, 0);
+
+  va_start(args, fmt);
+  int n = vsnprintf(sb->data + sb->len, sb->capacity - sb->len, fmt, args);
+  va_end(args);
+  if (n < 0)
+  {
+    sb->data[sb->len] = '\0';
+    return;
+  }
+  if ((size_t)n >= sb->capacity - sb->len)
+  {
+    sb_reserve(sb, n);
+    va_start(args, fmt);
+    vsnprintf(sb->data + sb->len, sb->capacity - sb->len, fmt, args);
+    va_end(args);
+  }
+  sb->len += n;
+}
+
+/**
+ * @Brief Replace a range of the string with other bytes
+ *
+ * Only the tail after the range moves, and the buffer is reallocated
+ * only when the string outgrows its capacity.
+ *
+ * @param sb The buffer
+ * @param at Offset of the range (at most len)
+ * @param n Length of the range (at + n at most len)
+ * @param s Replacement bytes (must not point into sb)
+ * @param slen Number of replacement bytes
+ */
+void sb_splice(StrBuf *sb, size_t at, size_t n, const char *s, size_t slen)
+{
+  if (slen > n)
+    sb_reserve(sb, slen - n);
+  if (!sb->data)
+    return;
+  memmove(sb->data + at + slen, sb->data + at + n, sb->len - at - n);
+  memcpy(sb->data + at, s, slen);
+  sb->len = sb->len - n + slen;
+  sb->data[sb->len] = '\0';
+}
+
+/**
+ * @Brief Replace the whole string
+ *
+ * @param sb The buffer
+ * @param s New contents (must not point into sb)
+ * @param n Number of bytes
+ */
+void sb_set(StrBuf *sb, const char *s, size_t n)
+{
+  sb_truncate(sb, 0);
+  sb_append(sb, s, n);
+}
+
+/**
+ * @Brief Shorten the string, keeping its capacity
+ *
+ * @param sb The buffer
+ * @param len New length (at most the current one)
+ */
+void sb_truncate(StrBuf *sb, size_t len)
+{
+  sb->len = len;
+  if (sb->data)
+    sb->data[len] = '\0';
+}
+
+/**
+ * @Brief Write the string to a file descriptor
+ *
+ * One write covers the whole string unless the descriptor takes less
+ * (a full pipe), in which case the rest follows.
+ *
+ * @param sb The buffer
+ * @param fd Descriptor to write to
+ * @return 0 on success, -1 if a write failed
+ */
+int sb_write(const StrBuf *sb, int fd)
+{
+  size_t done = 0;
+  while (done < sb->len)
+  {
+    ssize_t n = write(fd, sb->data + done, sb->len - done);
+    if (n == -1)
+    {
+      if (errno == EINTR)
+        continue;
+      return -1;
+    }
+    done += n;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Take the string out of the buffer
+ *
+ * @param sb The buffer, left empty
+ * @return The string (an empty one if nothing was written; caller frees)
+ */
+char *sb_release(StrBuf *sb)
+{
+  sb_reserve(sb, 0);
+  char *s = sb->data;
+  sb->data = NULL;
+  sb->len = 0;
+  sb->capacity = 0;
+  return s;
+}
+
+/**
+ * @Brief Free the string
+ *
+ * @param sb The buffer, left empty
+ */
+void sb_free(StrBuf *sb)
+{
+  free(sb->data);
+  sb->data = NULL;
+  sb->len = 0;
+  sb->capacity = 0;
+}
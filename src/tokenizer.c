@@ -0,0 +1,508 @@
+#include "../include/tokenizer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define TOK_X86 1
+#endif
+
+extern void clean_exit(int return_code);
+
+
+typedef void (*ClassifyFn)(const char *line, size_t len, ByteClasses *bc);
+
+/* Set the bits of the bytes in [from, len) one at a time */
+static void classify_tail(const char *line, size_t from, size_t len, ByteClasses *bc)
+{
+  for (size_t i = from; i < len; i++)
+  {
+    uint64_t bit = 1ULL << (i & 63);
+    switch (line[i])
+    {
+    case ' ':
+      bc->space[i >> 6] |= bit;
+      break;
+    case '\'':
+      bc->quote[i >> 6] |= bit;
+      break;
+    case '$':
+      bc->dollar[i >> 6] |= bit;
+      break;
+    case '|':
+    case '&':
+    case ';':
+    case '<':
+    case '>':
+      bc->op[i >> 6] |= bit;
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+static void classify_scalar(const char *line, size_t len, ByteClasses *bc)
+{
+  classify_tail(line, 0, len, bc);
+}
+
+#ifdef TOK_X86
+/*
+ * The vector classifiers handle 64 bytes per mask word. A partial last
+ * word is classified from a zero-padded copy, which never matches.
+ */
+#define CLASSIFY_BLOCKS(block_fn, line, len, bc)        \
+  do                                                    \
+  {                                                     \
+    size_t i_ = 0;                                      \
+    for (; i_ + 64 <= (len); i_ += 64)                  \
+      block_fn((line) + i_, (bc), i_ >> 6);             \
+    if (i_ < (len))                                     \
+    {                                                   \
+      char tail_[64] = {0};                             \
+      memcpy(tail_, (line) + i_, (len) - i_);           \
+      block_fn(tail_, (bc), i_ >> 6);                   \
+    }                                                   \
+  } while (0)
+
+#ifdef __SSE2__
+/* 16 bytes per compare, four compares per 64-bit mask word */
+static inline void classify_block_sse2(const char *block, ByteClasses *bc, size_t w)
+{
+  uint64_t s = 0, q = 0, o = 0, d = 0;
+
+  for (int k = 0; k < 4; k++)
+  {
+    __m128i v = _mm_loadu_si128((const __m128i *)(block + 16 * k));
+    __m128i ops = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('|')), _mm_cmpeq_epi8(v, _mm_set1_epi8('&'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(';')),
+                     _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('<')), _mm_cmpeq_epi8(v, _mm_set1_epi8('>')))));
+    s |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))) << (16 * k);
+    q |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\''))) << (16 * k);
+    o |= (uint64_t)(uint16_t)_mm_movemask_epi8(ops) << (16 * k);
+    d |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('$'))) << (16 * k);
+  }
+  bc->space[w] = s;
+  bc->quote[w] = q;
+  bc->op[w] = o;
+  bc->dollar[w] = d;
+}
+
+static void classify_sse2(const char *line, size_t len, ByteClasses *bc)
+{
+  CLASSIFY_BLOCKS(classify_block_sse2, line, len, bc);
+}
+#endif
+
+/* 32 bytes per compare, two compares per 64-bit mask word */
+__attribute__((target("avx2")))
+static inline uint32_t eq_mask_avx2(__m256i v, char c)
+{
+  return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)));
+}
+
+__attribute__((target("avx2")))
+static inline uint32_t op_mask_avx2(__m256i v)
+{
+  __m256i ops = _mm256_or_si256(
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('&'))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(';')),
+                      _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')),
+                                      _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')))));
+  return (uint32_t)_mm256_movemask_epi8(ops);
+}
+
+__attribute__((target("avx2")))
+static inline void classify_block_avx2(const char *block, ByteClasses *bc, size_t w)
+{
+  __m256i lo = _mm256_loadu_si256((const __m256i *)block);
+  __m256i hi = _mm256_loadu_si256((const __m256i *)(block + 32));
+  bc->space[w] = eq_mask_avx2(lo, ' ') | (uint64_t)eq_mask_avx2(hi, ' ') << 32;
+  bc->quote[w] = eq_mask_avx2(lo, '\'') | (uint64_t)eq_mask_avx2(hi, '\'') << 32;
+  bc->op[w] = op_mask_avx2(lo) | (uint64_t)op_mask_avx2(hi) << 32;
+  bc->dollar[w] = eq_mask_avx2(lo, '$') | (uint64_t)eq_mask_avx2(hi, '$') << 32;
+}
+
+__attribute__((target("avx2")))
+static void classify_avx2(const char *line, size_t len, ByteClasses *bc)
+{
+  CLASSIFY_BLOCKS(classify_block_avx2, line, len, bc);
+}
+#endif // TOK_X86
+
+static const struct
+{
+  const char *name;
+  ClassifyFn fn;
+} classifiers[] = {
+#ifdef TOK_X86
+    {"avx2", classify_avx2},
+#ifdef __SSE2__
+    {"sse2", classify_sse2},
+#endif
+#endif
+    {"scalar", classify_scalar},
+    {NULL, NULL}};
+
+static int selected_classifier = -1;
+
+/* Whether the CPU we run on can execute the named classifier */
+static int cpu_supports(const char *name)
+{
+#ifdef TOK_X86
+  if (strcmp(name, "avx2") == 0)
+    return __builtin_cpu_supports("avx2");
+#endif
+  (void)name;
+  return 1;
+}
+
+/**
+ * @Brief Force a classifier by name
+ *
+ * @param name "scalar", "sse2" or "avx2"; NULL restores automatic choice
+ * @return 0 on success, -1 if it is not compiled in or the CPU lacks it
+ */
+int tok_select(const char *name)
+{
+  if (name == NULL)
+  {
+    __atomic_store_n(&selected_classifier, -1, __ATOMIC_RELAXED);
+    return 0;
+  }
+  for (int i = 0; classifiers[i].name != NULL; i++)
+  {
+    if (strcmp(classifiers[i].name, name) == 0 && cpu_supports(name))
+    {
+      __atomic_store_n(&selected_classifier, i, __ATOMIC_RELAXED);
+      return 0;
+    }
+  }
+  return -1;
+}
+
+/* Pick the widest classifier the CPU supports (first in the table) */
+static int classifier_index(void)
+{
+  // Threads may race to make the choice; they all make the same one
+  int selected = __atomic_load_n(&selected_classifier, __ATOMIC_RELAXED);
+  if (selected < 0)
+  {
+    for (int i = 0; classifiers[i].name != NULL; i++)
+    {
+      if (cpu_supports(classifiers[i].name))
+      {
+        selected = i;
+        break;
+      }
+    }
+    __atomic_store_n(&selected_classifier, selected, __ATOMIC_RELAXED);
+  }
+  return selected;
+}
+
+static ClassifyFn classifier(void)
+{
+  return classifiers[classifier_index()].fn;
+}
+
+/* Name of the classifier in use */
+const char *tok_impl_name(void)
+{
+  return classifiers[classifier_index()].name;
+}
+
+/**
+ * @Brief Classify every byte of the line as space, quote, operator, dollar
+ * or other
+ *
+ * @param line The bytes to classify
+ * @param len Number of bytes
+ * @param bc Masks with room for TOK_MASK_WORDS(len) words each
+ */
+void tok_classify(const char *line, size_t len, ByteClasses *bc)
+{
+  bc->len = len;
+  bc->nwords = TOK_MASK_WORDS(len);
+  memset(bc->space, 0, bc->nwords * sizeof(uint64_t));
+  memset(bc->quote, 0, bc->nwords * sizeof(uint64_t));
+  memset(bc->op, 0, bc->nwords * sizeof(uint64_t));
+  memset(bc->dollar, 0, bc->nwords * sizeof(uint64_t));
+  classifier()(line, len, bc);
+}
+
+/* Position of the first byte at or after pos with a bit set in either
+   mask (b may be NULL), or len if there is none */
+static size_t next_set(const uint64_t *a, const uint64_t *b, size_t len, size_t pos)
+{
+  size_t nwords = TOK_MASK_WORDS(len);
+  size_t w = pos >> 6;
+  if (w >= nwords)
+    return len;
+  uint64_t bits = (a[w] | (b ? b[w] : 0)) & (~0ULL << (pos & 63));
+  while (!bits)
+  {
+    if (++w == nwords)
+      return len;
+    bits = a[w] | (b ? b[w] : 0);
+  }
+  size_t found = (w << 6) + __builtin_ctzll(bits);
+  return found < len ? found : len;
+}
+
+/* Position of the first clear bit at or after pos, or len if there is none */
+static size_t next_clear(const uint64_t *mask, size_t len, size_t pos)
+{
+  size_t nwords = TOK_MASK_WORDS(len);
+  size_t w = pos >> 6;
+  if (w >= nwords)
+    return len;
+  uint64_t bits = ~mask[w] & (~0ULL << (pos & 63));
+  while (!bits)
+  {
+    if (++w == nwords)
+      return len;
+    bits = ~mask[w];
+  }
+  size_t found = (w << 6) + __builtin_ctzll(bits);
+  return found < len ? found : len;
+}
+
+/**
+ * @Brief Prepare a lexer over a line, classifying all of its bytes once
+ *
+ * @param lx The lexer to initialize (release with lex_free)
+ * @param line The line to lex (need not be NUL terminated)
+ * @param len Number of bytes in the line
+ * @param operators Whether | & ; < > form operator tokens; when 0 they are
+ *                  ordinary word characters
+ */
+void lex_init(Lexer *lx, const char *line, size_t len, int operators)
+{
+  size_t nwords = TOK_MASK_WORDS(len);
+  uint64_t *masks = lx->stack_masks;
+
+  lx->heap_masks = NULL;
+  if (len > TOK_STACK_BYTES)
+  {
+    masks = lx->heap_masks = malloc(TOK_NMASKS * nwords * sizeof(uint64_t));
+    if (!masks)
+    {
+      perror("malloc");
+      clean_exit(EXIT_FAILURE);
+    }
+  }
+
+  lx->line = line;
+  lx->len = len;
+  lx->operators = operators;
+  lx->bc.space = masks;
+  lx->bc.quote = masks + nwords;
+  lx->bc.op = masks + 2 * nwords;
+  lx->bc.dollar = masks + 3 * nwords;
+  tok_classify(line, len, &lx->bc);
+  lx->pos = next_clear(lx->bc.space, len, 0);
+}
+
+/* Release the masks of a lexer */
+void lex_free(Lexer *lx)
+{
+  free(lx->heap_masks);
+  lx->heap_masks = NULL;
+}
+
+/* Operator token starting at line[p] */
+static void lex_operator(const Lexer *lx, size_t p, LexToken *tok)
+{
+  char c = lx->line[p];
+  int doubled = p + 1 < lx->len && lx->line[p + 1] == c;
+
+  tok->start = p;
+  tok->len = 1;
+  tok->expand = 0;
+  switch (c)
+  {
+  case '|':
+    tok->type = doubled ? TOK_OR_IF : TOK_PIPE;
+    break;
+  case '&':
+    tok->type = doubled ? TOK_AND_IF : TOK_AMP;
+    break;
+  case ';':
+    tok->type = TOK_SEMI;
+    doubled = 0;
+    break;
+  case '<':
+    tok->type = TOK_REDIR_IN;
+    doubled = 0;
+    break;
+  default:
+    tok->type = doubled ? TOK_REDIR_APPEND : TOK_REDIR_OUT;
+    break;
+  }
+  if (doubled)
+    tok->len = 2;
+}
+
+/**
+ * @Brief Produce the next token of the line
+ *
+ * Words are separated by spaces and, when operators are enabled, end at an
+ * operator character. A word starting with a single quote extends to the
+ * next single quote (the quotes are not part of the word) and may contain
+ * spaces and operator characters. The end of the line acts as a separator.
+ * Unquoted words containing a $ are flagged for parameter expansion, found
+ * from the dollar mask without looking at the word's bytes again; a $(
+ * extends the word to its closing parenthesis.
+ *
+ * @param lx The lexer
+ * @param tok Filled with the token (TOK_END at the end of the line)
+ * @return 0 on success, TOK_ERR_QUOTE for a missing closing quote,
+ *         TOK_ERR_PAREN for a missing closing parenthesis
+ */
+int lex_next(Lexer *lx, LexToken *tok)
+{
+  size_t p = lx->pos;
+  const uint64_t *op = lx->operators ? lx->bc.op : NULL;
+
+  if (p >= lx->len)
+  {
+    tok->type = TOK_END;
+    tok->start = tok->len = 0;
+    tok->expand = 0;
+    return 0;
+  }
+
+  if (op && (op[p >> 6] >> (p & 63)) & 1)
+  {
+    lex_operator(lx, p, tok);
+    p += tok->len;
+  }
+  else if (lx->line[p] == '\'')
+  {
+    size_t end = next_set(lx->bc.quote, NULL, lx->len, p + 1);
+    if (end == lx->len)
+      return TOK_ERR_QUOTE;
+    tok->type = TOK_WORD;
+    tok->start = p + 1;
+    tok->len = end - p - 1;
+    tok->expand = 0;
+    p = end + 1;
+  }
+  else
+  {
+    size_t end = next_set(lx->bc.space, op, lx->len, p);
+
+    // A $( runs to its closing parenthesis, across spaces and operators
+    size_t d = p;
+    while ((d = next_set(lx->bc.dollar, NULL, end, d)) < end)
+    {
+      if (d + 1 < lx->len && lx->line[d + 1] == '(')
+      {
+        size_t close = tok_match_paren(lx->line, lx->len, d + 1);
+        if (close == lx->len)
+          return TOK_ERR_PAREN;
+        d = close + 1;
+        end = next_set(lx->bc.space, op, lx->len, d);
+      }
+      else
+      {
+        d++;
+      }
+    }
+
+    tok->type = TOK_WORD;
+    tok->start = p;
+    tok->len = end - p;
+    // The expander only ever sees words the masks mark as holding a $
+    tok->expand = next_set(lx->bc.dollar, NULL, end, p) < end;
+    p = end;
+
+    /* "2>" and "2>>" redirect stderr */
+    if (op && tok->len == 1 && lx->line[tok->start] == '2' && p < lx->len && lx->line[p] == '>')
+    {
+      int append = p + 1 < lx->len && lx->line[p + 1] == '>';
+      tok->type = append ? TOK_REDIR_ERR_APPEND : TOK_REDIR_ERR;
+      tok->len = append ? 3 : 2;
+      p += append ? 2 : 1;
+    }
+  }
+
+  lx->pos = next_clear(lx->bc.space, lx->len, p);
+  return 0;
+}
+
+/**
+ * @Brief Find the parenthesis closing the one at line[open]
+ *
+ * @param line The line
+ * @param len Number of bytes in the line
+ * @param open Index of a '('
+ * @return Index of the matching ')', or len if there is none
+ */
+size_t tok_match_paren(const char *line, size_t len, size_t open)
+{
+  int depth = 0;
+  for (size_t i = open; i < len; i++)
+  {
+    if (line[i] == '\'')
+    {
+      const char *close = memchr(line + i + 1, '\'', len - i - 1);
+      if (!close)
+        return len;
+      i = close - line;
+    }
+    else if (line[i] == '(')
+    {
+      depth++;
+    }
+    else if (line[i] == ')' && --depth == 0)
+    {
+      return i;
+    }
+  }
+  return len;
+}
+
+/**
+ * @Brief Split a line into words (no operators) in one classification pass
+ *
+ * @param line The line to split (need not be NUL terminated)
+ * @param len Number of bytes in the line
+ * @param spans Output token spans
+ * @param max_spans Capacity of spans
+ * @return Number of tokens, TOK_ERR_QUOTE, TOK_ERR_PAREN or TOK_ERR_OVERFLOW
+ */
+int tok_split(const char *line, size_t len, TokSpan *spans, int max_spans)
+{
+  Lexer lx;
+  LexToken tok;
+  int count = 0;
+
+  lex_init(&lx, line, len, 0);
+  for (;;)
+  {
+    int err = lex_next(&lx, &tok);
+    if (err != 0)
+    {
+      count = err;
+      break;
+    }
+    if (tok.type == TOK_END)
+      break;
+    if (count == max_spans)
+    {
+      count = TOK_ERR_OVERFLOW;
+      break;
+    }
+    spans[count].start = tok.start;
+    spans[count].len = tok.len;
+    spans[count].expand = tok.expand;
+    count++;
+  }
+  lex_free(&lx);
+  return count;
+}
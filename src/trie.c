@@ -0,0 +1,339 @@
+#include "../include/trie.h"
+#include "../include/strbuf.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern void clean_exit(int return_code);
+
+static void *trie_alloc(size_t size)
+{
+  void *p = malloc(size);
+  if (!p)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+  return p;
+}
+
+static TrieNode *node_create(const char *label, size_t len)
+{
+  TrieNode *node = trie_alloc(sizeof(TrieNode));
+  node->label = trie_alloc(len + 1);
+  memcpy(node->label, label, len);
+  node->label[len] = '\0';
+  node->len = len;
+  node->refs = 0;
+  node->keys = 0;
+  node->children = NULL;
+  node->nchildren = 0;
+  node->capacity = 0;
+  return node;
+}
+
+static void node_free(TrieNode *node)
+{
+  for (int i = 0; i < node->nchildren; i++)
+    node_free(node->children[i]);
+  free(node->children);
+  free(node->label);
+  free(node);
+}
+
+/**
+ * @Brief Find the child whose label starts with c (binary search)
+ *
+ * @param node The parent node
+ * @param c First byte of the label
+ * @param pos Set to the index where such a child would be inserted
+ * @return Index of the child, or -1 if there is none
+ */
+static int find_child(const TrieNode *node, unsigned char c, int *pos)
+{
+  int lo = 0, hi = node->nchildren;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    unsigned char m = (unsigned char)node->children[mid]->label[0];
+    if (m == c)
+      return mid;
+    if (m < c)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (pos)
+    *pos = lo;
+  return -1;
+}
+
+static void add_child(TrieNode *node, int pos, TrieNode *child)
+{
+  if (node->nchildren == node->capacity)
+  {
+    int capacity = node->capacity ? node->capacity * 2 : 2;
+    TrieNode **grown = realloc(node->children, capacity * sizeof(TrieNode *));
+    if (!grown)
+    {
+      perror("realloc");
+      clean_exit(EXIT_FAILURE);
+    }
+    node->children = grown;
+    node->capacity = capacity;
+  }
+  memmove(node->children + pos + 1, node->children + pos,
+          (node->nchildren - pos) * sizeof(TrieNode *));
+  node->children[pos] = child;
+  node->nchildren++;
+}
+
+static size_t common_length(const char *a, size_t alen, const char *b)
+{
+  size_t k = 0;
+  while (k < alen && b[k] && a[k] == b[k])
+    k++;
+  return k;
+}
+
+/**
+ * @Brief Cut the label of node after k bytes, moving the rest (and
+ * everything below it) to a new single child
+ */
+static void split_node(TrieNode *node, size_t k)
+{
+  TrieNode *rest = node_create(node->label + k, node->len - k);
+  rest->refs = node->refs;
+  rest->keys = node->keys;
+  rest->children = node->children;
+  rest->nchildren = node->nchildren;
+  rest->capacity = node->capacity;
+
+  node->label[k] = '\0';
+  node->len = k;
+  node->refs = 0;
+  node->children = NULL;
+  node->nchildren = 0;
+  node->capacity = 0;
+  add_child(node, 0, rest);
+}
+
+/* Returns 1 if key was not in the subtree before */
+static int insert_rec(TrieNode *node, const char *key)
+{
+  if (!*key)
+  {
+    if (node->refs++ > 0)
+      return 0;
+    node->keys++;
+    return 1;
+  }
+
+  int pos;
+  int i = find_child(node, (unsigned char)key[0], &pos);
+  if (i < 0)
+  {
+    TrieNode *leaf = node_create(key, strlen(key));
+    leaf->refs = 1;
+    leaf->keys = 1;
+    add_child(node, pos, leaf);
+    node->keys++;
+    return 1;
+  }
+
+  TrieNode *child = node->children[i];
+  size_t k = common_length(child->label, child->len, key);
+  if (k < child->len)
+    split_node(child, k);
+  int added = insert_rec(child, key + k);
+  node->keys += added;
+  return added;
+}
+
+/* Returns 1 if the last insertion of key was removed from the subtree */
+static int remove_rec(TrieNode *node, const char *key)
+{
+  if (!*key)
+  {
+    if (node->refs == 0 || --node->refs > 0)
+      return 0;
+    node->keys--;
+    return 1;
+  }
+
+  int i = find_child(node, (unsigned char)key[0], NULL);
+  if (i < 0)
+    return 0;
+  TrieNode *child = node->children[i];
+  if (strncmp(child->label, key, child->len) != 0 || !remove_rec(child, key + child->len))
+    return 0;
+  node->keys--;
+
+  if (child->keys == 0)
+  {
+    node_free(child);
+    memmove(node->children + i, node->children + i + 1,
+            (node->nchildren - i - 1) * sizeof(TrieNode *));
+    node->nchildren--;
+  }
+  else if (child->refs == 0 && child->nchildren == 1)
+  {
+    // Keep the trie compressed: fold the child into its only child
+    TrieNode *grandchild = child->children[0];
+    char *label = trie_alloc(child->len + grandchild->len + 1);
+    memcpy(label, child->label, child->len);
+    memcpy(label + child->len, grandchild->label, grandchild->len + 1);
+    free(grandchild->label);
+    grandchild->label = label;
+    grandchild->len += child->len;
+    node->children[i] = grandchild;
+    free(child->children);
+    free(child->label);
+    free(child);
+  }
+  return 1;
+}
+
+/* Append up to max keys of the subtree at node (prefixed by kb) to keys */
+static void collect_keys(const TrieNode *node, StrBuf *kb, char **keys, size_t max, size_t *n)
+{
+  if (*n == max)
+    return;
+  size_t len = kb->len;
+  sb_append(kb, node->label, node->len);
+  if (node->refs)
+  {
+    keys[*n] = strdup(kb->data);
+    if (!keys[*n])
+    {
+      perror("strdup");
+      clean_exit(EXIT_FAILURE);
+    }
+    (*n)++;
+  }
+  for (int i = 0; i < node->nchildren && *n < max; i++)
+    collect_keys(node->children[i], kb, keys, max, n);
+  sb_truncate(kb, len);
+}
+
+/**
+ * @Brief Create an empty Trie
+ *
+ * @return Pointer to a newly created Trie
+ */
+Trie *trie_create(void)
+{
+  Trie *t = trie_alloc(sizeof(Trie));
+  memset(t, 0, sizeof(Trie));
+  t->root.label = trie_alloc(1);
+  t->root.label[0] = '\0';
+  return t;
+}
+
+/**
+ * @Brief Insert a key, or count one more insertion of it
+ *
+ * @param t Pointer to the Trie
+ * @param key The key string
+ */
+void trie_insert(Trie *t, const char *key)
+{
+  insert_rec(&t->root, key);
+}
+
+/**
+ * @Brief Undo one insertion of a key
+ *
+ * @param t Pointer to the Trie
+ * @param key The key string
+ */
+void trie_remove(Trie *t, const char *key)
+{
+  remove_rec(&t->root, key);
+}
+
+/**
+ * @Brief Number of distinct keys in the Trie
+ */
+size_t trie_size(const Trie *t)
+{
+  return t->root.keys;
+}
+
+/**
+ * @Brief Find the keys starting with a prefix
+ *
+ * @param t Pointer to the Trie
+ * @param prefix The prefix to complete
+ * @param common Set to the longest common prefix of the matches (or NULL)
+ * @param keys Receives up to max matching keys in byte order
+ * @param max Capacity of keys
+ * @return Number of matching keys
+ */
+size_t trie_complete(const Trie *t, const char *prefix, char **common, char **keys, size_t max)
+{
+  const TrieNode *node = &t->root;
+  StrBuf kb = STRBUF_INIT;
+  *common = NULL;
+
+  // Walk down to the subtree of the keys starting with prefix; the prefix
+  // may end inside an edge, whose keys all match
+  while (*prefix)
+  {
+    int i = find_child(node, (unsigned char)*prefix, NULL);
+    const TrieNode *child = i < 0 ? NULL : node->children[i];
+    size_t k = child ? common_length(child->label, child->len, prefix) : 0;
+    if (!child || (k < child->len && prefix[k]))
+    {
+      sb_free(&kb);
+      return 0;
+    }
+    node = child;
+    prefix += k;
+    if (*prefix)
+      sb_append(&kb, node->label, node->len);
+  }
+  if (node->keys == 0)
+  {
+    sb_free(&kb);
+    return 0;
+  }
+
+  // The matches share every label down to the first fork or key
+  size_t parent_len = kb.len;
+  const TrieNode *top = node;
+  if (node != &t->root)
+    sb_append(&kb, node->label, node->len);
+  while (node->refs == 0 && node->nchildren == 1)
+  {
+    node = node->children[0];
+    sb_append(&kb, node->label, node->len);
+  }
+  *common = strdup(kb.data ? kb.data : "");
+  if (!*common)
+  {
+    perror("strdup");
+    clean_exit(EXIT_FAILURE);
+  }
+
+  size_t n = 0;
+  sb_truncate(&kb, parent_len);
+  collect_keys(top, &kb, keys, max, &n);
+  sb_free(&kb);
+  return top->keys;
+}
+
+/**
+ * @Brief Free whole Trie
+ *
+ * @param t Pointer to the Trie
+ */
+void trie_free(Trie *t)
+{
+  for (int i = 0; i < t->root.nchildren; i++)
+    node_free(t->root.children[i]);
+  free(t->root.children);
+  free(t->root.label);
+  free(t);
+}
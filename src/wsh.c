@@ -2,6 +2,21 @@
 #include "../include/dynamic_array.h"
 #include "../include/utils.h"
 #include "../include/hash_map.h"
+#include "../include/alloc_stats.h"
+#include "../include/tokenizer.h"
+#include "../include/parser.h"
+#include "../include/script_cache.h"
+#include "../include/server.h"
+#include "../include/startup.h"
+#include "../include/path_index.h"
+#include "../include/completion.h"
+#include "../include/line_edit.h"
+#include "../include/env.h"
+#include "../include/expand.h"
+#include "../include/strbuf.h"
+#include "../include/shared_cache.h"
+#include "../include/parallel.h"
+#include "../include/event_loop.h"
 
 #include <stdio.h>     // fprintf, fgets, fopen
 #include <errno.h>     // errno
@@ -9,22 +24,32 @@
 #include <stdlib.h>    // malloc, free, exit
 #include <string.h>    // strcmp, strlen, strchr
 #include <assert.h>    // assert
-#include <unistd.h>    // fork, execv, access
+#include <unistd.h>    // fork, execve, access
 #include <sys/types.h> // pid_t
 #include <sys/wait.h>  // waitpid, WIFEXITED
 #include <limits.h>    // PATH_MAX
 #include <signal.h>    // kill, SIGTERM
+#include <fcntl.h>     // open, fcntl
+#include <setjmp.h>    // jmp_buf, longjmp
+
+extern char **environ;
 
 int rc; // return code 
 HashMap *alias_hm = NULL; // hash map to store aliases 
+HashMap *pending_alias_hm = NULL; // rc file alias definitions, run on first use
+static int shared_aliases = 0; // rc alias definitions are read from the shared cache
+static HashMap *shared_shadow = NULL; // Names whose shared rc definition no longer applies
+static unsigned long long shared_alias_digest; // Digest of the shared rc definitions
 DynamicArray *history_da = NULL; // dynamic array to command history
 FILE *batch_file = NULL; // Global to track batch file for cleanup - memory leak fix
+CompiledScript batch_script; // Compiled batch file, released in wsh_free
+jmp_buf *exit_jmp = NULL; // Set by server mode so exit ends the request, not the shell
 
 
 struct
 {
   const char *name;
-  int (*func)(int, char **);
+  builtin_fn func;
 } builtins[] = {
     {"exit", wsh_exit},
     {"alias", wsh_alias},
@@ -33,8 +58,67 @@ struct
     {"path", wsh_path},
     {"cd", wsh_cd},
     {"history", wsh_history},
+    {"export", wsh_export},
+    {"unset", wsh_unset},
+    {"env", wsh_env},
+#ifdef WSH_PROF
+    {"stats", wsh_stats},
+#endif
     {NULL, NULL}};
 
+/**
+ * Defines an entry of an alias map, adding a new name to tab completion
+ */
+static void alias_map_put(HashMap *hm, const char *name, const char *value)
+{
+  if (!hm_get(hm, name))
+  {
+    completion_add_command(name);
+  }
+  hm_put(hm, name, value);
+}
+
+/**
+ * Removes an entry of an alias map and its name from tab completion
+ */
+static void alias_map_delete(HashMap *hm, const char *name)
+{
+  if (hm_get(hm, name))
+  {
+    completion_remove_command(name);
+  }
+  hm_delete(hm, name);
+}
+
+/**
+ * Drops the rc definition of an alias about to be redefined or removed
+ */
+static void forget_rc_alias(const char *name)
+{
+  if (pending_alias_hm)
+  {
+    alias_map_delete(pending_alias_hm, name);
+  }
+  if (shared_aliases && !hm_get(shared_shadow, name))
+  {
+    if (shared_rc_alias(name, NULL))
+    {
+      completion_remove_command(name);
+    }
+    hm_put(shared_shadow, name, "");
+  }
+}
+
+/**
+ * Writes a builtin's formatted output with one write and frees it
+ */
+static void print_buffer(StrBuf *out)
+{
+  fflush(stdout);
+  sb_write(out, STDOUT_FILENO);
+  sb_free(out);
+}
+
 /**
  *Terminates the shell
 */
@@ -64,7 +148,6 @@ int wsh_history(int argc, char **argv)
   if (argc == 1)
   {
     da_print(history_da);
-    fflush(stdout);
     return EXIT_SUCCESS;
   }
   else
@@ -93,19 +176,45 @@ int wsh_history(int argc, char **argv)
   }
 }
 
+#ifdef WSH_PROF
+/**
+ * Prints the allocation counters of each subsystem (wsh-prof only)
+ */
+int wsh_stats(int argc, char **argv)
+{
+  (void)argv;
+  if (argc > 1)
+  {
+    wsh_warn(INVALID_STATS_USE);
+    return EXIT_FAILURE;
+  }
+  alloc_stats_report(stdout);
+  fflush(stdout);
+  return EXIT_SUCCESS;
+}
+
+/* Report allocations on stderr when the shell exits */
+static void report_alloc_stats(void)
+{
+  alloc_stats_report(stderr);
+}
+#endif
+
 /**
  * Manages command aliases
 */
 int wsh_alias(int argc, char **argv)
 {
-  if (argc == 1)
+  // alias lists every alias, alias -p prefix those starting with prefix
+  if (argc == 1 || (argc == 2 && strcmp(argv[1], "-p") == 0) ||
+      (argc == 3 && strcmp(argv[1], "-p") == 0 && strcmp(argv[2], "=") != 0))
   {
-    hm_print_sorted(alias_hm);
-    fflush(stdout);
+    resolve_all_aliases();
+    hm_print_sorted(alias_hm, argc == 3 ? argv[2] : NULL);
     return EXIT_SUCCESS;
   }
 
-  if (argc > 4 || strcmp(argv[2], "=") != 0)
+  if (argc < 3 || argc > 4 || strcmp(argv[2], "=") != 0)
   {
     wsh_warn(INVALID_ALIAS_USE);
     return EXIT_FAILURE;
@@ -124,7 +233,9 @@ int wsh_alias(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  hm_put(alias_hm, name, command);
+  ALLOC_SCOPE(ALLOC_ALIAS);
+  forget_rc_alias(name);
+  alias_map_put(alias_hm, name, command);
   return EXIT_SUCCESS;
 }
 
@@ -139,7 +250,9 @@ int wsh_unalias(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  hm_delete(alias_hm, argv[1]);
+  ALLOC_SCOPE(ALLOC_ALIAS);
+  forget_rc_alias(argv[1]);
+  alias_map_delete(alias_hm, argv[1]);
   return EXIT_SUCCESS;
 }
 
@@ -155,92 +268,53 @@ int wsh_which(int argc, char **argv)
   }
 
   const char *name = argv[1];
+  StrBuf out = STRBUF_INIT;
+  int result = EXIT_SUCCESS;
 
-  char *alias_cmd = hm_get(alias_hm, name);
+  char *alias_cmd = lookup_alias(name);
   if (alias_cmd)
   {
-    fprintf(stdout, WHICH_ALIAS, name, alias_cmd);
-    fflush(stdout);
-    return EXIT_SUCCESS;
-  }
-
-  for (int i = 0; builtins[i].name != NULL; i++)
-  {
-    if (strcmp(name, builtins[i].name) == 0)
-    {
-      fprintf(stdout, WHICH_BUILTIN, name);
-      fflush(stdout);
-      return EXIT_SUCCESS;
-    }
+    sb_printf(&out, WHICH_ALIAS, name, alias_cmd);
   }
-
-  char *full_path = NULL;
-
-  if (name[0] == '.' || name[0] == '/')
+  else if (find_builtin(name))
   {
-    if (access(name, X_OK) == 0)
-    {
-      full_path = strdup(name);
-      if (!full_path)
-      {
-        perror("strdup");
-        clean_exit(EXIT_FAILURE);
-      }
-    }
+    sb_printf(&out, WHICH_BUILTIN, name);
   }
   else
   {
-    char *path_env = getenv("PATH");
+    char *full_path = NULL;
 
-    if (path_env != NULL && strlen(path_env) > 0)
+    if (name[0] == '.' || name[0] == '/')
     {
-      char *path_copy = strdup(path_env);
-      if (!path_copy)
-      {
-        perror("strdup");
-        clean_exit(EXIT_FAILURE);
-      }
-
-      char *dir = strtok(path_copy, ":");
-      while (dir != NULL)
+      if (access(name, X_OK) == 0)
       {
-        size_t path_len = strlen(dir) + strlen(name) + 2;
-        char *temp_path = malloc(path_len);
-        if (!temp_path)
+        full_path = strdup(name);
+        if (!full_path)
         {
-          perror("malloc");
-          free(path_copy);
+          perror("strdup");
           clean_exit(EXIT_FAILURE);
         }
-
-        sprintf(temp_path, "%s/%s", dir, name);
-
-        if (access(temp_path, X_OK) == 0)
-        {
-          full_path = temp_path;
-          break;
-        }
-
-        free(temp_path);
-        dir = strtok(NULL, ":");
       }
-      free(path_copy);
     }
-  }
+    else
+    {
+      full_path = find_executable_path(name);
+    }
 
-  if (full_path)
-  {
-    fprintf(stdout, WHICH_EXTERNAL, name, full_path);
-    fflush(stdout);
-    free(full_path);
-    return EXIT_SUCCESS;
-  }
-  else
-  {
-    fprintf(stdout, WHICH_NOT_FOUND, name);
-    fflush(stdout);
-    return EXIT_FAILURE;
+    if (full_path)
+    {
+      sb_printf(&out, WHICH_EXTERNAL, name, full_path);
+      free(full_path);
+    }
+    else
+    {
+      sb_printf(&out, WHICH_NOT_FOUND, name);
+      result = EXIT_FAILURE;
+    }
   }
+
+  print_buffer(&out);
+  return result;
 }
 
 /**
@@ -256,23 +330,121 @@ int wsh_path(int argc, char **argv)
 
   if (argc == 1)
   {
-    char *path_env = getenv("PATH");
+    const char *path_env = env_get("PATH");
     if (path_env)
     {
-      fprintf(stdout, "%s\n", path_env);
-      fflush(stdout);
+      StrBuf out = STRBUF_INIT;
+      sb_appends(&out, path_env);
+      sb_append(&out, "\n", 1);
+      print_buffer(&out);
     }
     return EXIT_SUCCESS;
   }
   else
   {
-    if (setenv("PATH", argv[1], 1) == -1)
+    env_set("PATH", argv[1]);
+    path_index_invalidate();
+    shared_path_invalidate();
+    return EXIT_SUCCESS;
+  }
+}
+
+/**
+ * Checks that a string can be used as a variable name
+ */
+static int valid_env_name(const char *name, size_t len)
+{
+  if (len == 0 || (name[0] >= '0' && name[0] <= '9'))
+    return 0;
+  for (size_t i = 0; i < len; i++)
+  {
+    char c = name[i];
+    if (!(c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')))
+      return 0;
+  }
+  return 1;
+}
+
+/**
+ * Sets environment variables passed to commands
+ */
+int wsh_export(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    wsh_warn(INVALID_EXPORT_USE);
+    return EXIT_FAILURE;
+  }
+
+  // Check every assignment before making any
+  for (int i = 1; i < argc; i++)
+  {
+    char *eq = strchr(argv[i], '=');
+    if (!eq || !valid_env_name(argv[i], eq - argv[i]))
     {
-      perror("setenv");
+      wsh_warn(INVALID_EXPORT_USE);
       return EXIT_FAILURE;
     }
-    return EXIT_SUCCESS;
   }
+
+  for (int i = 1; i < argc; i++)
+  {
+    char *eq = strchr(argv[i], '=');
+    *eq = '\0';
+    env_set(argv[i], eq + 1);
+    if (strcmp(argv[i], "PATH") == 0)
+    {
+      path_index_invalidate();
+      shared_path_invalidate();
+    }
+    *eq = '=';
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * Removes environment variables
+ */
+int wsh_unset(int argc, char **argv)
+{
+  if (argc < 2)
+  {
+    wsh_warn(INVALID_UNSET_USE);
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 1; i < argc; i++)
+  {
+    env_unset(argv[i]);
+    if (strcmp(argv[i], "PATH") == 0)
+    {
+      path_index_invalidate();
+      shared_path_invalidate();
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+/**
+ * Prints the environment passed to commands
+ */
+int wsh_env(int argc, char **argv)
+{
+  (void)argv;
+  if (argc != 1)
+  {
+    wsh_warn(INVALID_ENV_USE);
+    return EXIT_FAILURE;
+  }
+
+  StrBuf out = STRBUF_INIT;
+  for (char **e = env_envp(); *e; e++)
+  {
+    sb_appends(&out, *e);
+    sb_append(&out, "\n", 1);
+  }
+  print_buffer(&out);
+  return EXIT_SUCCESS;
 }
 
 /**
@@ -290,7 +462,7 @@ int wsh_cd(int argc, char **argv)
 
   if (argc == 1)
   {
-    dir_to_go = getenv("HOME");
+    dir_to_go = (char *)env_get("HOME");
     if (!dir_to_go)
     {
       wsh_warn(CD_NO_HOME);
@@ -325,16 +497,45 @@ void wsh_free(void)
     hm_free(alias_hm);
     alias_hm = NULL;
   }
+  if (pending_alias_hm != NULL)
+  {
+    hm_free(pending_alias_hm);
+    pending_alias_hm = NULL;
+  }
+  if (shared_shadow != NULL)
+  {
+    hm_free(shared_shadow);
+    shared_shadow = NULL;
+  }
+  shared_aliases = 0;
+  shared_cache_detach();
   if (history_da != NULL)
   {
     da_free(history_da);
     history_da = NULL;
   }
+  completion_free();
+  env_free();
+  {
+    ALLOC_SCOPE(ALLOC_PATH);
+    path_index_free();
+  }
+  batch_free();
+  ev_free();
+}
+
+/**
+ * @Brief Close the batch file being executed and release its compiled form
+ */
+void batch_free(void)
+{
+  parallel_batch_free();
   if (batch_file != NULL)
   {
     fclose(batch_file);
     batch_file = NULL;
   }
+  script_cache_close(&batch_script);
 }
 
 /**
@@ -377,12 +578,112 @@ void free_argv(char **argv, int argc)
 }
 
 /**
- * Executes an external command by forking and using execv
+ * Looks up a builtin by name (NULL if name is not a builtin)
+ */
+builtin_fn find_builtin(const char *name)
+{
+  for (int i = 0; builtins[i].name != NULL; i++)
+  {
+    if (strcmp(name, builtins[i].name) == 0)
+    {
+      return builtins[i].func;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Opens path with the given flags onto the target descriptor
+ */
+static int redirect_fd(const char *path, int flags, int target_fd)
+{
+  int fd = open(path, flags, 0644);
+  if (fd == -1)
+  {
+    perror(path);
+    return -1;
+  }
+  if (fd != target_fd)
+  {
+    if (dup2(fd, target_fd) == -1)
+    {
+      perror("dup2");
+      close(fd);
+      return -1;
+    }
+    close(fd);
+  }
+  return 0;
+}
+
+/**
+ * Applies the redirections of a command to stdin, stdout and stderr.
+ * Returns 0 on success, -1 (after printing the error) otherwise.
+ */
+int apply_redirects(const SimpleCommand *cmd)
+{
+  if (cmd->in_path && redirect_fd(cmd->in_path, O_RDONLY, STDIN_FILENO) == -1)
+    return -1;
+  if (cmd->out_path &&
+      redirect_fd(cmd->out_path, O_WRONLY | O_CREAT | (cmd->out_append ? O_APPEND : O_TRUNC),
+                  STDOUT_FILENO) == -1)
+    return -1;
+  if (cmd->err_path &&
+      redirect_fd(cmd->err_path, O_WRONLY | O_CREAT | (cmd->err_append ? O_APPEND : O_TRUNC),
+                  STDERR_FILENO) == -1)
+    return -1;
+  return 0;
+}
+
+/**
+ * Runs a builtin in the shell process, applying the command's
+ * redirections for the duration of the call only
+ */
+int run_builtin(builtin_fn func, SimpleCommand *cmd)
+{
+  if (!cmd->in_path && !cmd->out_path && !cmd->err_path)
+  {
+    return func(cmd->argc, cmd->argv);
+  }
+
+  int saved[3];
+  fflush(stdout);
+  fflush(stderr);
+  for (int fd = 0; fd < 3; fd++)
+  {
+    saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, 3);
+  }
+
+  int result = EXIT_FAILURE;
+  if (apply_redirects(cmd) == 0)
+  {
+    result = func(cmd->argc, cmd->argv);
+  }
+  else
+  {
+    rc = EXIT_FAILURE;
+  }
+
+  fflush(stdout);
+  fflush(stderr);
+  for (int fd = 0; fd < 3; fd++)
+  {
+    if (saved[fd] != -1)
+    {
+      dup2(saved[fd], fd);
+      close(saved[fd]);
+    }
+  }
+  return result;
+}
+
+/**
+ * Executes an external command by forking and using execve
  */
-int execute_external_command(int argc, char **argv)
+int execute_external_command(SimpleCommand *cmd)
 {
-  assert(argc > 0);
-  char *command_name = argv[0];
+  assert(cmd->argc > 0);
+  char *command_name = cmd->argv[0];
   char *full_path = NULL;
   int is_absolute_or_relative = 0;
 
@@ -401,7 +702,7 @@ int execute_external_command(int argc, char **argv)
     full_path = find_executable_path(command_name);
     if (!full_path)
     {
-      char *path_env = getenv("PATH");
+      const char *path_env = env_get("PATH");
       if (path_env == NULL || strlen(path_env) == 0)
       {
         wsh_warn(EMPTY_PATH);
@@ -418,16 +719,20 @@ int execute_external_command(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  char **envp = env_envp();
   pid_t pid = fork();
   if (pid < 0)
   {
     perror("fork");
+    rc = EXIT_FAILURE;
     free(full_path);
     return EXIT_FAILURE;
   }
   else if (pid == 0)
   {
-    execv(full_path, argv);
+    if (apply_redirects(cmd) == -1)
+      _exit(EXIT_FAILURE);
+    execve(full_path, cmd->argv, envp);
     wsh_warn(CMD_NOT_FOUND, command_name);
     free(full_path);
     _exit(EXIT_FAILURE);
@@ -435,7 +740,7 @@ int execute_external_command(int argc, char **argv)
   else
   {
     int status;
-    if (waitpid(pid, &status, 0) == -1)
+    if (ev_wait_child(pid, &status) == -1)
     {
       perror("waitpid");
       free(full_path);
@@ -456,288 +761,166 @@ int execute_external_command(int argc, char **argv)
 }
 
 /**
- * Executes a single command line with alias substitution
+ * Substitutes the alias named by cmd->argv[0] (if any): the alias value is
+ * tokenized and takes the place of argv[0], followed by the remaining
+ * arguments unchanged; the alias words keep their own expansion flags.
+ * Returns 1 if an alias was substituted, 0 if argv[0] is not an alias and
+ * -1 if the result does not fit in argv (argv is then emptied).
  */
-int execute_command(const char *cmdline)
+int expand_alias(SimpleCommand *cmd)
 {
-  if (cmdline != NULL && strlen(cmdline) > 0)
-  {
-    char *temp = strdup(cmdline);
-    if (temp)
-    {
-      size_t len = strlen(temp);
-      if (len > 0 && temp[len - 1] == '\n')
-        temp[len - 1] = '\0';
-      if (strspn(temp, " \t") != strlen(temp))
-      {
-        da_put(history_da, cmdline);
-      }
-      free(temp);
-    }
-  }
+  ALLOC_SCOPE(ALLOC_ALIAS);
+  char *alias_cmd = lookup_alias(cmd->argv[0]);
+  if (!alias_cmd)
+    return 0;
+
+  char *alias_argv[MAX_ARGS + 1];
+  unsigned char alias_expand[MAX_ARGS];
+  int alias_argc;
+  parseline_no_subst(alias_cmd, alias_argv, alias_expand, &alias_argc);
+
+  if (alias_argc + cmd->argc - 1 > MAX_ARGS)
+  {
+    wsh_warn(TOO_MANY_ARGS, MAX_ARGS);
+    free_argv(alias_argv, alias_argc);
+    free_argv(cmd->argv, cmd->argc);
+    cmd->argc = 0;
+    cmd->argv[0] = NULL;
+    return -1;
+  }
+
+  free(cmd->argv[0]);
+  memmove(cmd->argv + alias_argc, cmd->argv + 1, (cmd->argc - 1) * sizeof(char *));
+  memmove(cmd->expand + alias_argc, cmd->expand + 1, cmd->argc - 1);
+  memcpy(cmd->argv, alias_argv, alias_argc * sizeof(char *));
+  memcpy(cmd->expand, alias_expand, alias_argc);
+  cmd->argc += alias_argc - 1;
+  cmd->argv[cmd->argc] = NULL;
+  return 1;
+}
 
-  char *cmdline_copy = strdup(cmdline);
-  if (!cmdline_copy)
+/**
+ * Runs one pipeline of a parsed list (the list is freed if it exits the shell)
+ */
+static int run_pipeline(CommandList *list, Pipeline *pl)
+{
+  if (pl->ncmds > 1)
   {
-    perror("strdup");
-    clean_exit(EXIT_FAILURE);
+    return execute_pipeline(pl);
   }
 
-  char *segments[MAX_ARGS];
-  int num_segments = 0;
-  int is_pipeline = 0;
-  int result = EXIT_SUCCESS;
+  SimpleCommand *cmd = &pl->cmds[0];
 
-  if (strchr(cmdline, '|'))
+  if (expand_alias(cmd) < 0)
   {
-    is_pipeline = 1;
+    return EXIT_FAILURE;
   }
-
-  if (is_pipeline)
+  if (expand_command(cmd) < 0)
+  {
+    return EXIT_FAILURE;
+  }
+  if (cmd->argc == 0)
   {
-    char *p = cmdline_copy;
-    char *segment_start = p;
+    rc = EXIT_SUCCESS;
+    return EXIT_SUCCESS;
+  }
 
-    while ((p = strchr(segment_start, '|')) != NULL && num_segments < MAX_ARGS)
+  // Handle exit separately to ensure proper memory cleanup
+  if (strcmp(cmd->argv[0], "exit") == 0)
+  {
+    if (cmd->argc > 1)
     {
-      *p = '\0';
-
-      char *s = segment_start;
-      while (*s && *s == ' ')
-        s++;
-      if (*s == '\0')
-      {
-        wsh_warn(EMPTY_PIPE_SEGMENT);
-        for (int j = 0; j < num_segments; j++)
-          free(segments[j]);
-        free(cmdline_copy);
-        return EXIT_FAILURE;
-      }
-
-      segments[num_segments] = strdup(segment_start);
-      if (!segments[num_segments])
-      {
-        perror("strdup");
-        free(cmdline_copy);
-        clean_exit(EXIT_FAILURE);
-      }
-      num_segments++;
-      segment_start = p + 1;
+      wsh_warn(INVALID_EXIT_USE);
+      return EXIT_FAILURE;
     }
-
-    if (num_segments < MAX_ARGS)
+    // Free all allocated memory before exiting
+    command_list_free(list);
+    if (exit_jmp)
     {
-      char *s = segment_start;
-      while (*s && *s == ' ')
-        s++;
-      if (*s == '\0' || *s == '\n')
-      {
-        wsh_warn(EMPTY_PIPE_SEGMENT);
-        for (int j = 0; j < num_segments; j++)
-          free(segments[j]);
-        free(cmdline_copy);
-        return EXIT_FAILURE;
-      }
-
-      segments[num_segments] = strdup(segment_start);
-      if (!segments[num_segments])
-      {
-        perror("strdup");
-        free(cmdline_copy);
-        clean_exit(EXIT_FAILURE);
-      }
-      num_segments++;
+      longjmp(*exit_jmp, 1);
     }
-    free(cmdline_copy);
-
-    for (int i = 0; i < num_segments; i++)
-    {
-      char *temp_argv[MAX_ARGS + 1];
-      int temp_argc;
-      char *segment_cmdline = segments[i];
-      char *temp_alias_subst = NULL;
-
-      parseline_no_subst(segment_cmdline, temp_argv, &temp_argc);
+    clean_exit(rc);
+  }
 
-      if (temp_argc == 0)
-      {
-        wsh_warn(EMPTY_PIPE_SEGMENT);
-        for (int j = 0; j < num_segments; j++)
-          free(segments[j]);
-        free_argv(temp_argv, temp_argc);
-        return EXIT_FAILURE;
-      }
-
-      char *command_name = temp_argv[0];
-      char *alias_cmd = hm_get(alias_hm, command_name);
-
-      if (alias_cmd)
-      {
-        size_t new_cmdline_len = strlen(alias_cmd);
-        for (int k = 1; k < temp_argc; k++)
-        {
-          new_cmdline_len += 1 + strlen(temp_argv[k]);
-        }
-        new_cmdline_len += 1;
-
-        temp_alias_subst = malloc(new_cmdline_len);
-        if (!temp_alias_subst)
-        {
-          perror("malloc");
-          for (int j = 0; j < num_segments; j++)
-            free(segments[j]);
-          free_argv(temp_argv, temp_argc);
-          clean_exit(EXIT_FAILURE);
-        }
-
-        strcpy(temp_alias_subst, alias_cmd);
-        for (int k = 1; k < temp_argc; k++)
-        {
-          strcat(temp_alias_subst, " ");
-          strcat(temp_alias_subst, temp_argv[k]);
-        }
-
-        free_argv(temp_argv, temp_argc);
-        parseline_no_subst(temp_alias_subst, temp_argv, &temp_argc);
-        command_name = temp_argv[0];
-
-        free(segments[i]);
-        segments[i] = temp_alias_subst;
-      }
-
-      int is_builtin = 0;
-      for (int j = 0; builtins[j].name != NULL; j++)
-      {
-        if (strcmp(command_name, builtins[j].name) == 0)
-        {
-          is_builtin = 1;
-          break;
-        }
-      }
-
-      if (!is_builtin)
-      {
-        char *path_to_exec = find_executable_path(command_name);
-        if (path_to_exec == NULL)
-        {
-          wsh_warn(CMD_NOT_FOUND, command_name);
-          for (int j = 0; j < num_segments; j++)
-            free(segments[j]);
-          free_argv(temp_argv, temp_argc);
-          return EXIT_FAILURE;
-        }
-        free(path_to_exec);
-      }
+  builtin_fn builtin = find_builtin(cmd->argv[0]);
+  if (builtin)
+  {
+    rc = run_builtin(builtin, cmd);
+    return rc == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  return execute_external_command(cmd);
+}
 
-      free_argv(temp_argv, temp_argc);
-    }
+/**
+ * Records a command line in the history unless it is blank
+ */
+void add_history(const char *cmdline)
+{
+  if (cmdline == NULL)
+    return;
+  // Blank lines (only spaces, tabs and the newline) are not recorded
+  if (cmdline[strspn(cmdline, " \t\n")] != '\0')
+  {
+    ALLOC_SCOPE(ALLOC_HISTORY);
+    da_put(history_da, cmdline);
+  }
+}
 
-    result = execute_pipeline(segments, num_segments);
+/**
+ * Executes a parsed list and frees it; && and || skip the next pipeline
+ * based on rc
+ */
+int execute_list(CommandList *list)
+{
+  int result = EXIT_SUCCESS;
 
-    for (int i = 0; i < num_segments; i++)
-      free(segments[i]);
-  }
-  else
+  for (int i = 0; i < list->count; i++)
   {
-    char *argv[MAX_ARGS + 1];
-    int argc = 0;
-    char *temp_cmdline = NULL;
-
-    parseline_no_subst(cmdline, argv, &argc);
+    result = run_pipeline(list, &list->items[i]);
 
-    if (argc == 0)
+    while (i < list->count - 1 &&
+           ((list->items[i].next_op == LIST_AND && rc != EXIT_SUCCESS) ||
+            (list->items[i].next_op == LIST_OR && rc == EXIT_SUCCESS)))
     {
-      free(cmdline_copy);
-      return EXIT_SUCCESS;
+      i++;
     }
+  }
 
-    char *command = argv[0];
-    char *alias_cmd = hm_get(alias_hm, command);
-
-    if (alias_cmd)
-    {
-      size_t new_cmdline_len = strlen(alias_cmd);
-      for (int k = 1; k < argc; k++)
-      {
-        new_cmdline_len += 1 + strlen(argv[k]);
-      }
-      new_cmdline_len += 1;
-
-      temp_cmdline = malloc(new_cmdline_len);
-      if (!temp_cmdline)
-      {
-        perror("malloc");
-        free_argv(argv, argc);
-        free(cmdline_copy);
-        clean_exit(EXIT_FAILURE);
-      }
-
-      strcpy(temp_cmdline, alias_cmd);
-      for (int k = 1; k < argc; k++)
-      {
-        strcat(temp_cmdline, " ");
-        strcat(temp_cmdline, argv[k]);
-      }
-
-      free_argv(argv, argc);
-      parseline_no_subst(temp_cmdline, argv, &argc);
-      command = argv[0];
+  command_list_free(list);
+  return result;
+}
 
-      if (argc == 0)
-      {
-        result = EXIT_SUCCESS;
-        free(temp_cmdline);
-        free(cmdline_copy);
-        return result;
-      }
-    }
+/**
+ * Executes a command line with alias substitution. The line is parsed
+ * once into a list and recorded in the history once.
+ */
+int execute_command(const char *cmdline)
+{
+  add_history(cmdline);
 
-    // Handle exit separately to ensure proper memory cleanup
-    if (strcmp(command, "exit") == 0)
-    {
-      if (argc > 1)
-      {
-        wsh_warn(INVALID_EXIT_USE);
-        result = EXIT_FAILURE;
-      }
-      else
-      {
-        // Free all allocated memory before exiting
-        free_argv(argv, argc);
-        if (temp_cmdline)
-          free(temp_cmdline);
-        free(cmdline_copy);
-        clean_exit(rc);
-      }
-    }
-    else
-    {
-      // Check for other builtins
-      int is_builtin = 0;
-      for (int i = 0; builtins[i].name != NULL; i++)
-      {
-        if (strcmp(command, builtins[i].name) == 0)
-        {
-          is_builtin = 1;
-          rc = builtins[i].func(argc, argv);
-          result = rc == EXIT_SUCCESS ? EXIT_SUCCESS : EXIT_FAILURE;
-          break;
-        }
-      }
+  CommandList list;
+  if (parse_command_list(cmdline, &list) != 0)
+  {
+    return EXIT_FAILURE;
+  }
+  return execute_list(&list);
+}
 
-      if (!is_builtin)
-      {
-        result = execute_external_command(argc, argv);
-      }
-    }
+/**
+ * Executes line i of a compiled batch script without parsing it again
+ */
+int execute_script_line(const CompiledScript *cs, int i)
+{
+  const char *cmdline = script_line_text(cs, i);
+  CommandList list;
 
-    free_argv(argv, argc);
-    if (temp_cmdline)
-      free(temp_cmdline);
-    free(cmdline_copy);
+  if (!script_line_list(cs, i, &list))
+  {
+    // Syntax errors are reported by parsing the line as it is executed
+    return execute_command(cmdline);
   }
-
-  return result;
+  add_history(cmdline);
+  return execute_list(&list);
 }
 
 /**
@@ -745,6 +928,7 @@ int execute_command(const char *cmdline)
  */
 char *find_executable_path(const char *command_name)
 {
+  ALLOC_SCOPE(ALLOC_PATH);
   if (command_name[0] == '/' || (command_name[0] == '.' && command_name[1] == '/'))
   {
     if (access(command_name, X_OK) == 0)
@@ -754,7 +938,23 @@ char *find_executable_path(const char *command_name)
     return NULL;
   }
 
-  char *path_env = getenv("PATH");
+  // Once built, the index follows the PATH directories, so the shared
+  // table only spares a shell that has not built it yet
+  char *full_path = NULL;
+  if (!path_index_ready() && (full_path = shared_path_lookup(command_name)) != NULL)
+  {
+    return full_path;
+  }
+  if (path_index_lookup(command_name, &full_path))
+  {
+    if (full_path)
+    {
+      shared_path_publish(command_name, full_path);
+    }
+    return full_path;
+  }
+
+  const char *path_env = env_get("PATH");
   if (path_env == NULL || strlen(path_env) == 0)
   {
     return NULL;
@@ -768,7 +968,7 @@ char *find_executable_path(const char *command_name)
   }
 
   char *dir = strtok(path_copy, ":");
-  char *full_path = NULL;
+  full_path = NULL;
   while (dir != NULL)
   {
     size_t path_len = strlen(dir) + strlen(command_name) + 2;
@@ -790,31 +990,23 @@ char *find_executable_path(const char *command_name)
     dir = strtok(NULL, ":");
   }
   free(path_copy);
+  if (full_path)
+  {
+    shared_path_publish(command_name, full_path);
+  }
   return full_path;
 }
 
 /**
- * Executes a single command segment in a pipeline
+ * Executes a single command of a pipeline (in the forked child)
  */
-void execute_segment(const char *segment_cmdline, int in_fd, int out_fd)
+void execute_segment(SimpleCommand *cmd, int in_fd, int out_fd)
 {
-  char *argv[MAX_ARGS + 1];
-  int argc;
-
-  parseline_no_subst(segment_cmdline, argv, &argc);
-
-  if (argc == 0)
-  {
-    free_argv(argv, argc);
-    _exit(EXIT_FAILURE);
-  }
-
   if (in_fd != STDIN_FILENO)
   {
     if (dup2(in_fd, STDIN_FILENO) == -1)
     {
       perror("dup2 (in_fd)");
-      free_argv(argv, argc);
       _exit(EXIT_FAILURE);
     }
     close(in_fd);
@@ -825,22 +1017,25 @@ void execute_segment(const char *segment_cmdline, int in_fd, int out_fd)
     if (dup2(out_fd, STDOUT_FILENO) == -1)
     {
       perror("dup2 (out_fd)");
-      free_argv(argv, argc);
       _exit(EXIT_FAILURE);
     }
     close(out_fd);
   }
 
-  char *command_name = argv[0];
+  /* Explicit redirections take precedence over the pipe */
+  if (apply_redirects(cmd) == -1)
+  {
+    _exit(EXIT_FAILURE);
+  }
 
-  for (int i = 0; builtins[i].name != NULL; i++)
+  char *command_name = cmd->argv[0];
+
+  builtin_fn builtin = find_builtin(command_name);
+  if (builtin)
   {
-    if (strcmp(command_name, builtins[i].name) == 0)
-    {
-      int exit_code = builtins[i].func(argc, argv);
-      free_argv(argv, argc);
-      _exit(exit_code);
-    }
+    int exit_code = builtin(cmd->argc, cmd->argv);
+    fflush(stdout);
+    _exit(exit_code);
   }
 
   char *path_to_exec = find_executable_path(command_name);
@@ -848,26 +1043,75 @@ void execute_segment(const char *segment_cmdline, int in_fd, int out_fd)
   if (!path_to_exec)
   {
     wsh_warn(CMD_NOT_FOUND, command_name);
-    free_argv(argv, argc);
     _exit(EXIT_FAILURE);
   }
 
-  execv(path_to_exec, argv);
+  execve(path_to_exec, cmd->argv, env_envp());
 
-  perror("execv");
+  perror("execve");
   free(path_to_exec);
-  free_argv(argv, argc);
   _exit(EXIT_FAILURE);
 }
 
+/**
+ * Expands aliases in every command of a pipeline and checks that each one
+ * is a builtin or an executable, so nothing runs if any command is missing
+ */
+static int prepare_pipeline(Pipeline *pl)
+{
+  for (int i = 0; i < pl->ncmds; i++)
+  {
+    SimpleCommand *cmd = &pl->cmds[i];
+
+    if (expand_alias(cmd) < 0 || expand_command(cmd) < 0)
+      return EXIT_FAILURE;
+
+    if (cmd->argc == 0)
+    {
+      wsh_warn(EMPTY_PIPE_SEGMENT);
+      return EXIT_FAILURE;
+    }
+
+    if (!find_builtin(cmd->argv[0]))
+    {
+      char *path_to_exec = find_executable_path(cmd->argv[0]);
+      if (path_to_exec == NULL)
+      {
+        wsh_warn(CMD_NOT_FOUND, cmd->argv[0]);
+        return EXIT_FAILURE;
+      }
+      free(path_to_exec);
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
 /**
  * Executes a pipeline of commands concurrently
  */
-int execute_pipeline(char **segments, int num_segments)
+int execute_pipeline(Pipeline *pl)
 {
   int i;
+  int num_segments = pl->ncmds;
   int prev_pipe_read_fd = STDIN_FILENO;
-  int pids[MAX_ARGS];
+
+  if (prepare_pipeline(pl) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  pid_t *pids = malloc(num_segments * sizeof(pid_t));
+  if (!pids)
+  {
+    perror("malloc");
+    clean_exit(EXIT_FAILURE);
+  }
+
+  /* Children inherit stdio buffers; flush so nothing is written twice */
+  fflush(stdout);
+  fflush(stderr);
+  /* Build envp once here rather than in every child */
+  env_envp();
 
   for (i = 0; i < num_segments - 1; i++)
   {
@@ -875,8 +1119,10 @@ int execute_pipeline(char **segments, int num_segments)
     if (pipe(pipefd) == -1)
     {
       perror("pipe");
+      rc = EXIT_FAILURE;
       for (int j = 0; j < i; j++)
         kill(pids[j], SIGTERM);
+      free(pids);
       return EXIT_FAILURE;
     }
 
@@ -884,16 +1130,18 @@ int execute_pipeline(char **segments, int num_segments)
     if (pid < 0)
     {
       perror("fork");
+      rc = EXIT_FAILURE;
       close(pipefd[0]);
       close(pipefd[1]);
       for (int j = 0; j < i; j++)
         kill(pids[j], SIGTERM);
+      free(pids);
       return EXIT_FAILURE;
     }
     else if (pid == 0)
     {
       close(pipefd[0]);
-      execute_segment(segments[i], prev_pipe_read_fd, pipefd[1]);
+      execute_segment(&pl->cmds[i], prev_pipe_read_fd, pipefd[1]);
     }
     else
     {
@@ -913,13 +1161,15 @@ int execute_pipeline(char **segments, int num_segments)
   if (pid_last < 0)
   {
     perror("fork");
+    rc = EXIT_FAILURE;
     for (int j = 0; j < i; j++)
       kill(pids[j], SIGTERM);
+    free(pids);
     return EXIT_FAILURE;
   }
   else if (pid_last == 0)
   {
-    execute_segment(segments[i], prev_pipe_read_fd, STDOUT_FILENO);
+    execute_segment(&pl->cmds[i], prev_pipe_read_fd, STDOUT_FILENO);
   }
   else
   {
@@ -933,7 +1183,7 @@ int execute_pipeline(char **segments, int num_segments)
   int status;
   int all_success = EXIT_SUCCESS;
 
-  if (waitpid(pid_last, &status, 0) == -1)
+  if (ev_wait_child(pid_last, &status) == -1)
   {
     perror("waitpid");
     rc = EXIT_FAILURE;
@@ -953,16 +1203,18 @@ int execute_pipeline(char **segments, int num_segments)
 
   for (int j = 0; j < num_segments - 1; j++)
   {
-    if (waitpid(pids[j], &status, 0) == -1)
+    if (ev_wait_child(pids[j], &status) == -1)
     {
       perror("waitpid");
       all_success = EXIT_FAILURE;
     }
   }
 
+  free(pids);
   return all_success;
 }
 
+#ifndef WSH_NO_MAIN
 /**
  * @Brief Main entry point for the shell
  *
@@ -972,9 +1224,57 @@ int execute_pipeline(char **segments, int num_segments)
  */
 int main(int argc, char **argv)
 {
-  alias_hm = hm_create();
-  history_da = da_create(0);
-  setenv("PATH", "/bin:/usr/bin", 1);
+  // The client only forwards its request: it needs none of the shell state
+  if (argc >= 2 && strcmp(argv[1], "--client") == 0)
+  {
+    return client_main(argc - 2, argv + 2);
+  }
+
+  if (argc >= 2 && strcmp(argv[1], "--startup-profile") == 0)
+  {
+    startup_profile_begin();
+    argc--;
+    argv++;
+  }
+
+  // wsh -j N script runs up to N lines of the script at once; with -k,
+  // their output is kept in the order of the lines
+  int jobs = 1;
+  int keep_order = 0;
+  if (argc >= 2 && strcmp(argv[1], "-j") == 0)
+  {
+    keep_order = argc == 5 && strcmp(argv[3], "-k") == 0;
+    char *end;
+    long n = argc == 4 + keep_order ? strtol(argv[2], &end, 10) : 0;
+    const char *script = argv[argc - 1];
+    if (n < 1 || n > PARALLEL_MAX_JOBS || *end != '\0' || strncmp(script, "--", 2) == 0 ||
+        strcmp(script, "-k") == 0)
+    {
+      wsh_warn(INVALID_WSH_USE);
+      return EXIT_FAILURE;
+    }
+    jobs = n;
+    argv[2 + keep_order] = argv[0];
+    argc -= 2 + keep_order;
+    argv += 2 + keep_order;
+  }
+
+#ifdef WSH_PROF
+  atexit(report_alloc_stats);
+#endif
+  {
+    ALLOC_SCOPE(ALLOC_ALIAS);
+    alias_hm = hm_create();
+  }
+  startup_phase("alias map");
+  {
+    ALLOC_SCOPE(ALLOC_HISTORY);
+    history_da = da_create(0);
+  }
+  startup_phase("history");
+  env_init(environ);
+  env_set("PATH", "/bin:/usr/bin");
+  startup_phase("environment");
 
   if (argc > 2)
   {
@@ -982,21 +1282,355 @@ int main(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
-  switch (argc)
+  rc_load();
+  startup_phase("rc file");
+
+  if (argc == 2 && strcmp(argv[1], "--server") == 0)
   {
-  case 1:
+    startup_report(stderr);
+    rc = server_main();
+  }
+  else if (argc == 1)
+  {
+    startup_report(stderr);
     interactive_main();
-    break;
-  case 2:
+  }
+  else if (jobs > 1)
+  {
+    rc = parallel_batch_main(argv[1], jobs, keep_order);
+  }
+  else
+  {
     rc = batch_main(argv[1]);
-    break;
-  default:
-    break;
   }
 
   wsh_free();
   return rc;
 }
+#endif // WSH_NO_MAIN
+
+/***************************************************
+ * Startup
+ ***************************************************/
+
+/**
+ * @Brief Run one line of the rc file (not recorded in history)
+ *
+ * @param line The command line
+ */
+static void run_rc_line(const char *line)
+{
+  CommandList list;
+  if (parse_command_list(line, &list) == 0)
+  {
+    execute_list(&list);
+  }
+}
+
+/**
+ * @Brief Name of the alias an rc line defines, if the line is exactly
+ * `alias NAME = VALUE` with VALUE one word or one quoted string. Only such
+ * lines can be put off until NAME is used without changing what they do.
+ *
+ * @param line The rc line
+ * @param name Receives the alias name
+ * @param size Size of name
+ * @return 1 if the line is a deferrable alias definition, 0 otherwise
+ */
+static int rc_alias_name(const char *line, char *name, size_t size)
+{
+  static const char *word_end = " '|&;<>\n";
+  const char *p = line + strspn(line, " ");
+
+  if (strncmp(p, "alias ", 6) != 0)
+    return 0;
+  p += 6;
+  p += strspn(p, " ");
+
+  size_t n = strcspn(p, word_end);
+  if (n == 0 || n >= size || p[n] != ' ')
+    return 0;
+  memcpy(name, p, n);
+  name[n] = '\0';
+  p += n;
+  p += strspn(p, " ");
+
+  if (*p != '=' || (p[1] != ' ' && p[1] != '\n' && p[1] != '\0'))
+    return 0;
+  p++;
+  p += strspn(p, " ");
+
+  if (*p == '\'')
+  {
+    const char *close = strchr(p + 1, '\'');
+    if (!close)
+      return 0;
+    p = close + 1;
+  }
+  else
+  {
+    p += strcspn(p, word_end);
+  }
+  p += strspn(p, " ");
+  return *p == '\0' || (*p == '\n' && p[1] == '\0');
+}
+
+/**
+ * @Brief Run the rc file as compiled by another process: its other lines
+ * now, its alias definitions from the shared cache on first use
+ *
+ * @param identity Identity of the rc file
+ * @return 1 if the shared cache held the file
+ */
+static int rc_load_shared(unsigned long long identity)
+{
+  StrBuf commands = STRBUF_INIT;
+  if (!shared_rc_match(identity, &commands, &shared_alias_digest))
+  {
+    sb_free(&commands);
+    return 0;
+  }
+
+  {
+    ALLOC_SCOPE(ALLOC_ALIAS);
+    shared_shadow = hm_create();
+  }
+  shared_aliases = 1;
+  for (size_t i = 0; i < commands.len; i += strlen(commands.data + i) + 1)
+  {
+    run_rc_line(commands.data + i);
+  }
+  sb_free(&commands);
+  return 1;
+}
+
+/**
+ * @Brief Load ~/.wshrc (or $WSH_RC). Alias definitions are only indexed by
+ * name and run when the alias is first looked up; other lines run now.
+ * With $WSH_SHARED_CACHE set, the index and the other lines are shared
+ * with later shells until the file changes.
+ */
+void rc_load(void)
+{
+  char path[PATH_MAX];
+  const char *rc_env = env_get(RC_FILE_ENV);
+  const char *home = env_get("HOME");
+  int n;
+
+  if (rc_env && *rc_env)
+    n = snprintf(path, sizeof(path), "%s", rc_env);
+  else if (home && *home)
+    n = snprintf(path, sizeof(path), "%s/" RC_FILE, home);
+  else
+    return;
+  if (n < 0 || (size_t)n >= sizeof(path))
+    return;
+
+  unsigned long long identity = 0;
+  if (shared_cache_attach() == 0)
+  {
+    identity = shared_rc_identity(path);
+    if (rc_load_shared(identity))
+      return;
+  }
+
+  FILE *fp = fopen(path, "r");
+  if (!fp)
+    return;
+
+  // What other shells need to skip reading the file
+  StrBuf aliases = STRBUF_INIT;
+  StrBuf commands = STRBUF_INIT;
+  char line[MAX_LINE];
+  char name[MAX_LINE];
+  while (fgets(line, sizeof(line), fp) != NULL)
+  {
+    if (rc_alias_name(line, name, sizeof(name)))
+    {
+      ALLOC_SCOPE(ALLOC_ALIAS);
+      if (!pending_alias_hm)
+        pending_alias_hm = hm_create();
+      alias_map_put(pending_alias_hm, name, line);
+      if (identity)
+      {
+        sb_append(&aliases, name, strlen(name) + 1);
+        sb_append(&aliases, line, strlen(line) + 1);
+      }
+    }
+    else
+    {
+      if (identity)
+        sb_append(&commands, line, strlen(line) + 1);
+      run_rc_line(line);
+    }
+  }
+  fclose(fp);
+
+  if (identity)
+  {
+    shared_rc_publish(identity, &aliases, &commands,
+                      pending_alias_hm ? hm_digest(pending_alias_hm) : 0);
+  }
+  sb_free(&aliases);
+  sb_free(&commands);
+}
+
+/**
+ * @Brief Run the pending rc definition of an alias, if there is one
+ *
+ * @param name The alias name
+ */
+static void resolve_alias(const char *name)
+{
+  char *copy = NULL;
+  char *line = pending_alias_hm ? hm_get(pending_alias_hm, name) : NULL;
+  if (line)
+  {
+    copy = strdup(line);
+    if (!copy)
+    {
+      perror("strdup");
+      clean_exit(EXIT_FAILURE);
+    }
+    alias_map_delete(pending_alias_hm, name);
+  }
+  else if (shared_aliases && !hm_get(shared_shadow, name))
+  {
+    StrBuf shared = STRBUF_INIT;
+    if (!shared_rc_alias(name, &shared))
+    {
+      sb_free(&shared);
+      return;
+    }
+    hm_put(shared_shadow, name, "");
+    completion_remove_command(name);
+    copy = sb_release(&shared);
+  }
+  if (!copy)
+    return;
+
+  // Defining the alias must not change the status seen by the user
+  int saved_rc = rc;
+  run_rc_line(copy);
+  rc = saved_rc;
+  free(copy);
+}
+
+/**
+ * @Brief Run every pending rc alias definition (before listing aliases)
+ */
+void resolve_all_aliases(void)
+{
+  HashMap *pending = pending_alias_hm;
+  pending_alias_hm = NULL;
+  StrBuf shared = STRBUF_INIT;
+  HashMap *shadow = shared_shadow;
+  if (shared_aliases)
+  {
+    shared_rc_aliases(&shared);
+    shared_aliases = 0;
+    shared_shadow = NULL;
+  }
+
+  int saved_rc = rc;
+  for (int i = 0; pending && i < TABLE_SIZE; i++)
+  {
+    for (Entry *e = pending->buckets[i]; e; e = e->next)
+    {
+      run_rc_line(e->value);
+      completion_remove_command(e->key);
+    }
+  }
+  for (size_t i = 0; i < shared.len;)
+  {
+    const char *name = shared.data + i;
+    const char *line = name + strlen(name) + 1;
+    i = line + strlen(line) + 1 - shared.data;
+    if (!hm_get(shadow, name))
+    {
+      completion_remove_command(name);
+      run_rc_line(line);
+    }
+  }
+  rc = saved_rc;
+  sb_free(&shared);
+  if (pending)
+    hm_free(pending);
+  if (shadow)
+    hm_free(shadow);
+}
+
+/**
+ * @Brief Value of an alias, running its pending rc definition first
+ *
+ * @param name The alias name
+ * @return The alias value, or NULL if name is not an alias
+ */
+char *lookup_alias(const char *name)
+{
+  if (pending_alias_hm || shared_aliases)
+  {
+    resolve_alias(name);
+  }
+  return hm_get(alias_hm, name);
+}
+
+/**
+ * @Brief Digest of the defined and pending aliases (for the script cache)
+ */
+unsigned long long alias_digest(void)
+{
+  unsigned long long digest = hm_digest(alias_hm);
+  if (pending_alias_hm)
+  {
+    digest ^= hm_digest(pending_alias_hm) * 0x9e3779b97f4a7c15ULL;
+  }
+  if (shared_aliases)
+  {
+    digest ^= (shared_alias_digest + hm_digest(shared_shadow)) * 0xc2b2ae3d27d4eb4fULL;
+  }
+  return digest;
+}
+
+/**
+ * @Brief Start tab completion with the builtins and the aliases defined
+ * so far; later alias changes and PATH changes update it as they happen
+ */
+static void completion_start(void)
+{
+  completion_init();
+  for (int i = 0; builtins[i].name != NULL; i++)
+  {
+    completion_add_command(builtins[i].name);
+  }
+  HashMap *maps[] = {alias_hm, pending_alias_hm};
+  for (size_t m = 0; m < sizeof(maps) / sizeof(maps[0]); m++)
+  {
+    for (int i = 0; maps[m] && i < TABLE_SIZE; i++)
+    {
+      for (Entry *e = maps[m]->buckets[i]; e; e = e->next)
+      {
+        completion_add_command(e->key);
+      }
+    }
+  }
+  if (shared_aliases)
+  {
+    StrBuf shared = STRBUF_INIT;
+    shared_rc_aliases(&shared);
+    for (size_t i = 0; i < shared.len;)
+    {
+      const char *name = shared.data + i;
+      const char *line = name + strlen(name) + 1;
+      i = line + strlen(line) + 1 - shared.data;
+      if (!hm_get(shared_shadow, name))
+      {
+        completion_add_command(name);
+      }
+    }
+    sb_free(&shared);
+  }
+}
 
 /***************************************************
  * Modes of Execution
@@ -1009,8 +1643,26 @@ int main(int argc, char **argv)
 void interactive_main(void)
 {
   char cmdline[MAX_LINE];
+  int editing = isatty(STDIN_FILENO) && isatty(STDOUT_FILENO);
+  if (editing)
+  {
+    completion_start();
+  }
   while (1)
   {
+    if (editing)
+    {
+      fflush(stdout);
+      char *line = line_edit_read(PROMPT, history_da);
+      if (!line)
+      {
+        clean_exit(rc);
+      }
+      execute_command(line);
+      free(line);
+      continue;
+    }
+
     fprintf(stdout, PROMPT);
     fflush(stdout);
 
@@ -1049,12 +1701,28 @@ int batch_main(const char *script_file)
 
   batch_file = fp; // Store globally for cleanup in wsh_free
 
-  char cmdline[MAX_LINE];
   int result = EXIT_SUCCESS;
 
-  while (fgets(cmdline, MAX_LINE, fp) != NULL)
+  // Scripts are compiled once and the parsed lines reused while unchanged
+  int compiled = script_cache_open(script_file, fp, alias_digest(), &batch_script) == 0;
+  startup_phase("script load");
+  startup_report(stderr);
+
+  if (compiled)
   {
-    result = execute_command(cmdline);
+    for (int i = 0; i < batch_script.nlines; i++)
+    {
+      result = execute_script_line(&batch_script, i);
+    }
+    script_cache_close(&batch_script);
+  }
+  else
+  {
+    char cmdline[MAX_LINE];
+    while (fgets(cmdline, MAX_LINE, fp) != NULL)
+    {
+      result = execute_command(cmdline);
+    }
   }
 
   fclose(fp);
@@ -1069,92 +1737,58 @@ int batch_main(const char *script_file)
 /**
  * @Brief Parse a command line into arguments without doing
  * any alias substitutions.
- * Handles single quotes to allow spaces within arguments.
+ * Handles single quotes to allow spaces within arguments. Token
+ * boundaries come from tok_split, which classifies the whole line at once.
  *
  * @param cmdline The command line to parse
- * @param argv Array to store the parsed arguments (must be preallocated)
+ * @param argv Array to store the parsed arguments (must be preallocated
+ *             with room for MAX_ARGS + 1 entries)
+ * @param expand If not NULL, set to whether each argument needs parameter
+ *               expansion (room for MAX_ARGS entries)
  * @param argc Pointer to store the number of parsed arguments
  */
-void parseline_no_subst(const char *cmdline, char **argv, int *argc)
+void parseline_no_subst(const char *cmdline, char **argv, unsigned char *expand, int *argc)
 {
+  ALLOC_SCOPE(ALLOC_PARSER);
   if (!cmdline)
   {
     *argc = 0;
     argv[0] = NULL;
     return;
   }
-  char *buf = strdup(cmdline);
-  if (!buf)
-  {
-    perror("strdup");
-    clean_exit(EXIT_FAILURE);
-  }
-  /* Replace trailing newline with space */
-  const size_t len = strlen(buf);
-  if (len > 0 && buf[len - 1] == '\n')
-    buf[len - 1] = ' ';
-  else
-  {
-    char *new_buf = realloc(buf, len + 2);
-    if (!new_buf)
-    {
-      perror("realloc");
-      free(buf);
-      clean_exit(EXIT_FAILURE);
-    }
-    buf = new_buf;
-    strcat(buf, " ");
-  }
 
-  int count = 0;
-  char *p = buf;
-  while (*p && *p == ' ')
-    p++; /* skip leading spaces */
+  /* A trailing newline separates like a space */
+  size_t len = strlen(cmdline);
+  if (len > 0 && cmdline[len - 1] == '\n')
+    len--;
 
-  while (*p)
+  TokSpan spans[MAX_ARGS];
+  int count = tok_split(cmdline, len, spans, MAX_ARGS);
+  if (count < 0)
   {
-    char *token_start = p;
-    char *token = NULL;
-    if (*p == '\'')
-    {
-      token_start = ++p;
-      token = strchr(p, '\'');
-      if (!token)
-      {
-        /* Handle missing closing quote - Print Missing closing quote to stderr */
-        wsh_warn(MISSING_CLOSING_QUOTE);
-        free(buf);
-        for (int i = 0; i < count; i++)
-          free(argv[i]);
-        *argc = 0;
-        argv[0] = NULL;
-        return;
-      }
-      *token = '\0';
-      p = token + 1;
-    }
+    if (count == TOK_ERR_QUOTE)
+      wsh_warn(MISSING_CLOSING_QUOTE);
+    else if (count == TOK_ERR_PAREN)
+      wsh_warn(UNMATCHED_PAREN);
     else
+      wsh_warn(TOO_MANY_ARGS, MAX_ARGS);
+    *argc = 0;
+    argv[0] = NULL;
+    return;
+  }
+
+  for (int i = 0; i < count; i++)
+  {
+    argv[i] = strndup(cmdline + spans[i].start, spans[i].len);
+    if (!argv[i])
     {
-      token = strchr(p, ' ');
-      if (!token)
-        break;
-      *token = '\0';
-      p = token + 1;
-    }
-    argv[count] = strdup(token_start);
-    if (!argv[count])
-    {
-      perror("strdup");
-      for (int i = 0; i < count; i++)
-        free(argv[i]);
-      free(buf);
+      perror("strndup");
+      free_argv(argv, i);
       clean_exit(EXIT_FAILURE);
     }
-    count++;
-    while (*p && (*p == ' '))
-      p++;
+    if (expand)
+      expand[i] = spans[i].expand;
   }
   argv[count] = NULL;
   *argc = count;
-  free(buf);
 }
@@ -0,0 +1,182 @@
+#!/usr/bin/env bash
+#
+# Regression scripts for wsh.
+#
+# Each case writes a batch script into a scratch directory, runs it under
+# the wsh binary being tested and compares what it printed (stdout and
+# stderr together) and its exit status with what is expected.
+#
+# Usage: tests/regress.sh [wsh]
+#   wsh           binary under test (default ./wsh)
+
+set -uo pipefail
+
+wsh=$(realpath "${1:-./wsh}")
+if [[ ! -x $wsh ]]; then
+  echo "wsh binary not found: $wsh (run make first)" >&2
+  exit 1
+fi
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+# Keep the user's rc file and script cache out of the way
+export WSH_RC=$tmp/wshrc WSH_CACHE_DIR=$tmp/cache
+: >"$WSH_RC"
+
+failed=0
+
+# check <name> <expected output> <expected status> <wsh argument...>
+check() {
+  local name=$1 expected=$2 expected_rc=$3 out rc=0
+  shift 3
+  out=$(cd "$tmp" && timeout 20 "$wsh" "$@" 2>&1) || rc=$?
+  if [[ $out == "$expected" && $rc == "$expected_rc" ]]; then
+    echo "ok    $name"
+  else
+    echo "FAIL  $name"
+    echo "  expected (status $expected_rc):"
+    sed 's/^/    /' <<<"$expected"
+    echo "  got (status $rc):"
+    sed 's/^/    /' <<<"$out"
+    failed=1
+  fi
+}
+
+# A forked child ($(...) here) must not take the inotify events meant for
+# the shell, or the shell's PATH index misses the new command for good
+mkdir "$tmp/d1"
+cat >"$tmp/fork_events.wsh" <<SCRIPT
+path $tmp/d1:/bin:/usr/bin
+cp /bin/echo $tmp/d1/foo2
+ls \$(ls $tmp/d1/foo2)
+foo2 c
+SCRIPT
+check "path index: events after a fork" "$tmp/d1/foo2
+c" 0 fork_events.wsh
+
+# A missing PATH directory is watched for and indexed once it appears
+cat >"$tmp/missing_dir.wsh" <<SCRIPT
+path $tmp/later/bin:/bin:/usr/bin
+mkdir -p $tmp/later/bin
+cp /bin/echo $tmp/later/bin/foo3
+foo3 found
+SCRIPT
+check "path index: missing directory appears" "found" 0 missing_dir.wsh
+
+# With the shared cache, a command added to an earlier PATH directory
+# shadows the one other shells recorded
+mkdir "$tmp/d2"
+cat >"$tmp/shared_shadow.wsh" <<SCRIPT
+path $tmp/d2:/bin:/usr/bin
+ls -d $tmp/d2
+cp /bin/echo $tmp/d2/ls
+ls SHADOWED
+SCRIPT
+WSH_SHARED_CACHE=1 check "shared cache: shadowed command" "$tmp/d2
+SHADOWED" 0 shared_shadow.wsh
+
+# -j exits with the same status as a serial run of the script
+printf '/bin/true\nfalse\n' >"$tmp/last_false.wsh"
+printf '/bin/true\nnosuchcmd\n' >"$tmp/last_missing.wsh"
+check "parallel batch: status after a failing command" "" 0 -j 2 last_false.wsh
+check "parallel batch: status after a missing command" \
+  "Command not found or not an executable: nosuchcmd" 1 -j 2 last_missing.wsh
+
+# Quoted | and ; are part of the word, not operators
+cat >"$tmp/quoted_ops.wsh" <<'SCRIPT'
+echo 'a | b' 'c;d' | cat
+SCRIPT
+check "parser: quoted | and ;" "a | b c;d" 0 quoted_ops.wsh
+
+# A redirection without a file name is an error, and the script goes on
+printf 'echo lost >\necho next\n' >"$tmp/no_target.wsh"
+check "parser: missing redirect target" "Missing file name for redirection
+next" 0 no_target.wsh
+
+# 2>> appends stderr; it is not an argument "2" and a stdout >>
+cat >"$tmp/err_append.wsh" <<'SCRIPT'
+echo out 2>>err.txt
+ls /nonexistent 2>>err.txt
+ls /nonexistent 2>> err.txt
+grep -c nonexistent err.txt
+SCRIPT
+check "parser: 2>> appends stderr" "out
+2" 0 err_append.wsh
+
+# ;, && and || run the next pipeline on the status of the last one
+cat >"$tmp/lists.wsh" <<'SCRIPT'
+false || echo ran
+true && false && echo skipped
+true && echo yes; false || echo no
+false && echo a || echo b
+SCRIPT
+check "lists: && and || short-circuit" "ran
+yes
+no
+b" 0 lists.wsh
+
+# export, unset and env change and show what commands are started with
+cat >"$tmp/env.wsh" <<'SCRIPT'
+export WSH_T1=one
+env | grep ^WSH_T1=
+export WSH_T1=two
+/usr/bin/env | grep ^WSH_T1=
+unset WSH_T1
+env | grep ^WSH_T1= || echo unset
+SCRIPT
+check "environment: export, unset and env" "WSH_T1=one
+WSH_T1=two
+unset" 0 env.wsh
+
+# ${VAR} ends the name where the word goes on, $VARsuffix is another
+# variable and single quotes keep the text as it is
+cat >"$tmp/expand.wsh" <<'SCRIPT'
+export V=val
+echo ${V}suffix $Vsuffix. '$V'
+SCRIPT
+check "expansion: \${VAR}, \$VARsuffix and '\$VAR'" "valsuffix . \$V" 0 expand.wsh
+
+# $$ is the shell's pid, in a substitution or pipeline stage too
+cat >"$tmp/shell_pid.wsh" <<'SCRIPT'
+echo $$ >pids
+echo $(echo $$) >>pids
+echo $$ | cat >>pids
+sort -u pids | wc -l
+SCRIPT
+check "expansion: \$\$ in forked commands" "1" 0 shell_pid.wsh
+
+# $(...) nests, can sit inside a word and may hold a command list
+cat >"$tmp/subst.wsh" <<'SCRIPT'
+echo $(echo a $(echo b $(echo c)))
+echo x$(echo y)z
+echo $(echo one; echo two)
+SCRIPT
+check "substitution: nested \$(...)" "a b c
+xyz
+one two" 0 subst.wsh
+
+# alias -p lists the aliases starting with the prefix, in name order
+cat >"$tmp/alias_prefix.wsh" <<'SCRIPT'
+alias ll = 'ls -l'
+alias zz = 'echo z'
+alias la = 'ls -a'
+alias l = ls
+alias lx = 'ls -x'
+unalias lx
+alias -p l
+SCRIPT
+check "aliases: alias -p prefix" "l = 'ls'
+la = 'ls -a'
+ll = 'ls -l'" 0 alias_prefix.wsh
+
+# -j jobs expand $$ to the shell's pid, as a serial run does
+cat >"$tmp/parallel_pid.wsh" <<'SCRIPT'
+echo $$ >jpid1
+echo $(echo $$) >jpid2
+echo $$ | cat >jpid3
+SCRIPT
+printf 'sort -u jpid1 jpid2 jpid3 | wc -l\n' >"$tmp/count_pids.wsh"
+check "parallel batch: \$\$ in jobs" "" 0 -j 2 parallel_pid.wsh
+check "parallel batch: one pid for \$\$" "1" 0 count_pids.wsh
+
+exit $failed